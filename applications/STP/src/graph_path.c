@@ -58,11 +58,12 @@ void pathheapCorrect(
    SCIP_Real cost,
    int    mode)
 {
-   int    t;
+   SCIP_Real dist;
    int    c;
    int    j;
 
-   path[l].dist = (mode == MST_MODE) ? cost : (path[k].dist + cost);
+   dist = (mode == MST_MODE) ? cost : (path[k].dist + cost);
+   path[l].dist = dist;
    path[l].edge = edge;
 
    /* new node? */
@@ -72,19 +73,18 @@ void pathheapCorrect(
       state[l]      = (*count);
    }
 
-   /* Heap shift up */
+   /* Heap shift up; the parents are moved down and l is stored only at its final position */
    j = state[l];
    c = j / 2;
-   while( (j > 1) && path[heap[c]].dist > path[heap[j]].dist )
+   while( (j > 1) && path[heap[c]].dist > dist )
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]  = l;
+   state[l] = j;
 }
 
 inline static
@@ -94,31 +94,30 @@ int pathheapGetNearest(
    int* RESTRICT count,    /* pointer to store the number of elements on the heap */
    const PATH* path)
 {
+   SCIP_Real dist;
    int   k;
-   int   t;
+   int   last;
    int   c;
    int   j;
 
    /* Heap shift down
-    * (Oberstes Element runter und korrigieren)
+    * (Oberstes Element runter und korrigieren);
+    * the smaller children are moved up and the last element is stored only at its final position
     */
    k              = heap[1];
    j              = 1;
    c              = 2;
-   heap[1]        = heap[(*count)--];
-   state[heap[1]] = 1;
+   last           = heap[(*count)--];
+   dist           = path[last].dist;
 
    if ((*count) > 2)
       if (LT(path[heap[3]].dist, path[heap[2]].dist))
          c++;
 
-   while((c <= (*count)) && GT(path[heap[j]].dist, path[heap[c]].dist))
+   while((c <= (*count)) && GT(dist, path[heap[c]].dist))
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c             += c;
 
@@ -126,6 +125,9 @@ int pathheapGetNearest(
          if (LT(path[heap[c + 1]].dist, path[heap[c]].dist))
             c++;
    }
+   heap[j]     = last;
+   state[last] = j;
+
    return(k);
 }
 
@@ -139,29 +141,24 @@ void pathheapReset(
    int    node
    )
 {
-   int    t;
    int    c;
    int    j;
 
    path[node].dist = 0.0;
 
-   heap[++(*count)] = node;
-   state[node]      = (*count);
-
-   /* heap shift up */
-   j = state[node];
+   /* heap shift up; the parents are moved down and node is stored only at its final position */
+   j = ++(*count);
    c = j / 2;
 
-   while( (j > 1) && GT(path[heap[c]].dist, path[heap[j]].dist) )
+   while( (j > 1) && GT(path[heap[c]].dist, 0.0) )
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]     = node;
+   state[node] = j;
 }
 
 
@@ -447,26 +444,23 @@ void graph_pathHeapAdd(
    int* count              /* pointer to store the number of elements on the heap */
    )
 {
+   const SCIP_Real dist = path[node].dist;
    int c;
    int j;
 
-   heap[++(*count)] = node;
-   state[node]      = (*count);
-
-   /* Heap shift up */
-   j = state[node];
+   /* Heap shift up; the parents are moved down and node is stored only at its final position */
+   j = ++(*count);
    c = j / 2;
 
-   while((j > 1) && GT(path[heap[c]].dist, path[heap[j]].dist))
+   while((j > 1) && GT(path[heap[c]].dist, dist))
    {
-      const int t = heap[c];
-      heap[c] = heap[j];
-      heap[j] = t;
+      heap[j] = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j = c;
       c = j / 2;
    }
+   heap[j] = node;
+   state[node] = j;
 }
 
 
@@ -50,6 +50,12 @@
 #include "blockmemshell/memory.h"
 #include "scip/rbtree.h"
 
+/* the chunk pool is protected by a lock of the task interface if SCIP is compiled thread safe */
+#if defined(WITH_SCIPDEF) && defined(SCIP_THREADSAFE)
+#include "tpi/tpi.h"
+#define CHKPOOL_USELOCK
+#endif
+
 /* uncomment the following to enable the use of a memlist in debug mode
  * that checks for some memory leaks and allows to add the additional
  * checks enabled with the defines below.
@@ -667,6 +673,7 @@ struct BMS_BlkMem
    long long             maxmemused;         /**< maximal number of used bytes in the memory header */
    long long             maxmemunused;       /**< maximal number of allocated but not used bytes in the memory header */
    long long             maxmemallocated;    /**< maximal number of allocated bytes in the memory header */
+   BMS_CHKPOOL*          chunkpool;          /**< pool that takes the chunks freed by this block memory, or NULL */
    int                   initchunksize;      /**< number of elements in the first chunk of each chunk block */
    int                   garbagefactor;      /**< garbage collector is called, if at least garbagefactor * avg. chunksize
                                               *   elements are free (-1: disable garbage collection) */
@@ -729,6 +736,7 @@ struct BMS_ChkMem
    int                   initchunksize;      /**< number of elements in the first chunk */
    int                   garbagefactor;      /**< garbage collector is called, if at least garbagefactor * avg. chunksize 
                                               *   elements are free (-1: disable garbage collection) */
+   BMS_CHKPOOL*          chunkpool;          /**< pool that takes the destroyed chunks of this chunk block, or NULL */
 #ifndef NDEBUG
    char*                 filename;           /**< source file, where this chunk block was created */
    int                   line;               /**< source line, where this chunk block was created */
@@ -737,6 +745,150 @@ struct BMS_ChkMem
 #endif
 };
 
+#define CHKPOOL_HASHPOWER                   6 /**< power for size of the hash table of a chunk pool */
+#define CHKPOOL_HASHSIZE (1<<CHKPOOL_HASHPOWER) /**< size of the hash table of a chunk pool is 2^CHKPOOL_HASHPOWER */
+
+typedef struct Poolblock POOLBLOCK;     /**< memory block of a destroyed chunk that is kept in a chunk pool */
+
+/** memory block of a destroyed chunk that is kept in a chunk pool; the header is stored in the block itself */
+struct Poolblock
+{
+   POOLBLOCK*            next;               /**< next memory block in the same hash bucket */
+   size_t                size;               /**< size of the memory block in bytes */
+};
+
+/** pool of the memory of destroyed chunks, shared between several block memories
+ *
+ *  Each block memory keeps its free elements in the free lists of its own chunk blocks, which is the fast path and
+ *  does not need any synchronization. Chunks that become completely unused are, instead of being returned to the
+ *  operating system, put into the chunk pool, from which any block memory attached to the pool can take them again
+ *  when it needs a new chunk of the same size. Thus, block memories that are used in different threads, e.g., by the
+ *  concurrent solvers, can reuse each other's memory.
+ */
+struct BMS_ChkPool
+{
+   POOLBLOCK*            blockhash[CHKPOOL_HASHSIZE]; /**< hash table of the memory blocks, hashed by size */
+#ifdef CHKPOOL_USELOCK
+   SCIP_LOCK             lock;               /**< lock to protect the pool */
+#endif
+   long long             maxsize;            /**< maximal number of bytes that are kept in the pool */
+   long long             memsize;            /**< number of bytes currently kept in the pool */
+   long long             maxmemsize;         /**< maximal number of bytes that were kept in the pool */
+   long long             nreused;            /**< number of memory blocks that were taken from the pool */
+   int                   nuses;              /**< number of times the pool is captured */
+};
+
+/** acquires the lock of the chunk pool */
+static
+void chkpoolLock(
+   BMS_CHKPOOL*          chunkpool           /**< chunk pool */
+   )
+{
+#ifdef CHKPOOL_USELOCK
+   if( SCIPtpiAcquireLock(&chunkpool->lock) != SCIP_OKAY )
+   {
+      errorMessage("Could not acquire lock of chunk pool %p.\n", (void*)chunkpool);
+   }
+#else
+   (void) chunkpool;
+#endif
+}
+
+/** releases the lock of the chunk pool */
+static
+void chkpoolUnlock(
+   BMS_CHKPOOL*          chunkpool           /**< chunk pool */
+   )
+{
+#ifdef CHKPOOL_USELOCK
+   if( SCIPtpiReleaseLock(&chunkpool->lock) != SCIP_OKAY )
+   {
+      errorMessage("Could not release lock of chunk pool %p.\n", (void*)chunkpool);
+   }
+#else
+   (void) chunkpool;
+#endif
+}
+
+/** calculates the hash number of a memory block size in the chunk pool */
+static
+int chkpoolGetHashNumber(
+   size_t                size                /**< size of the memory block */
+   )
+{
+   return (int) (((uint32_t)(size / ALIGNMENT) * UINT32_C(0x9e3779b9)) >> (32-CHKPOOL_HASHPOWER)); /*lint !e571*/
+}
+
+/** removes a memory block of the given size from the chunk pool; returns NULL if the pool has no such block */
+static
+void* chkpoolGetBlock(
+   BMS_CHKPOOL*          chunkpool,          /**< chunk pool */
+   size_t                size                /**< size of the memory block */
+   )
+{
+   POOLBLOCK** blockptr;
+   POOLBLOCK* block;
+
+   assert(chunkpool != NULL);
+   assert(size >= sizeof(POOLBLOCK));
+
+   chkpoolLock(chunkpool);
+
+   blockptr = &chunkpool->blockhash[chkpoolGetHashNumber(size)];
+   while( *blockptr != NULL && (*blockptr)->size != size )
+      blockptr = &(*blockptr)->next;
+
+   block = *blockptr;
+   if( block != NULL )
+   {
+      *blockptr = block->next;
+      chunkpool->memsize -= (long long)size;
+      chunkpool->nreused++;
+      assert(chunkpool->memsize >= 0);
+   }
+
+   chkpoolUnlock(chunkpool);
+
+   return (void*)block;
+}
+
+/** puts a memory block into the chunk pool; returns FALSE if the pool is full and the block has to be freed */
+static
+int chkpoolPutBlock(
+   BMS_CHKPOOL*          chunkpool,          /**< chunk pool */
+   void*                 ptr,                /**< memory block */
+   size_t                size                /**< size of the memory block */
+   )
+{
+   POOLBLOCK* block;
+   int hashnumber;
+   int retval;
+
+   assert(chunkpool != NULL);
+   assert(ptr != NULL);
+   assert(size >= sizeof(POOLBLOCK));
+
+   retval = FALSE;
+
+   chkpoolLock(chunkpool);
+
+   if( chunkpool->memsize + (long long)size <= chunkpool->maxsize )
+   {
+      hashnumber = chkpoolGetHashNumber(size);
+      block = (POOLBLOCK*)ptr;
+      block->size = size;
+      block->next = chunkpool->blockhash[hashnumber];
+      chunkpool->blockhash[hashnumber] = block;
+      chunkpool->memsize += (long long)size;
+      chunkpool->maxmemsize = MAX(chunkpool->maxmemsize, chunkpool->memsize);
+      retval = TRUE;
+   }
+
+   chkpoolUnlock(chunkpool);
+
+   return retval;
+}
+
 /* define a find function to find a chunk in a red black tree of chunks */
 #define CHUNK_LT(ptr,chunk)  ptr < chunk->store
 #define CHUNK_GT(ptr,chunk)  ptr >= chunk->storeend
@@ -1056,9 +1208,15 @@ int createChunk(
    assert(BMSisAligned(sizeof(CHUNK)));
    assert( chkmem->elemsize < INT_MAX / storesize );
    assert( sizeof(CHUNK) < MAXMEMSIZE - (size_t)(storesize * chkmem->elemsize) ); /*lint !e571 !e647*/
-   BMSallocMemorySize(&newchunk, sizeof(CHUNK) + storesize * chkmem->elemsize);
+   newchunk = NULL;
+   if( chkmem->chunkpool != NULL )
+      newchunk = (CHUNK*) chkpoolGetBlock(chkmem->chunkpool, sizeof(CHUNK) + (size_t)storesize * chkmem->elemsize); /*lint !e571*/
    if( newchunk == NULL )
-      return FALSE;
+   {
+      BMSallocMemorySize(&newchunk, sizeof(CHUNK) + storesize * chkmem->elemsize);
+      if( newchunk == NULL )
+         return FALSE;
+   }
 
    /* the store is allocated directly behind the chunk header */
    newchunk->store = (void*) ((char*) newchunk + sizeof(CHUNK));
@@ -1113,6 +1271,14 @@ void destroyChunk(
    if( memsize != NULL )
       (*memsize) -= ((long long)sizeof(CHUNK) + (long long)(*chunk)->storesize * (*chunk)->elemsize);
 
+   /* keep the memory for other block memories if a chunk pool is attached and has space left */
+   if( (*chunk)->chkmem->chunkpool != NULL && chkpoolPutBlock((*chunk)->chkmem->chunkpool, (void*)*chunk,
+         sizeof(CHUNK) + (size_t)(*chunk)->storesize * (*chunk)->elemsize) ) /*lint !e571*/
+   {
+      *chunk = NULL;
+      return;
+   }
+
    /* free chunk header and store (allocated in one call) */
    BMSfreeMemory(chunk);
 }
@@ -1246,6 +1412,7 @@ BMS_CHKMEM* createChkmem(
    chkmem->eagerfreesize = 0;
    chkmem->initchunksize = initchunksize;
    chkmem->garbagefactor = garbagefactor;
+   chkmem->chunkpool = NULL;
 #ifndef NDEBUG
    chkmem->filename = NULL;
    chkmem->line = 0;
@@ -1743,6 +1910,7 @@ BMS_BLKMEM* BMScreateBlockMemory_call(
          blkmem->chkmemhash[i] = NULL;
       blkmem->initchunksize = initchunksize;
       blkmem->garbagefactor = garbagefactor;
+      blkmem->chunkpool = NULL;
       blkmem->memused = 0;
       blkmem->memallocated = 0;
       blkmem->maxmemused = 0;
@@ -1804,6 +1972,8 @@ void BMSdestroyBlockMemory_call(
    if( *blkmem != NULL )
    {
       BMSclearBlockMemory_call(*blkmem, filename, line);
+      if( (*blkmem)->chunkpool != NULL )
+         BMSreleaseChunkPool_call(&(*blkmem)->chunkpool, filename, line);
       BMSfreeMemory(blkmem);
       assert(*blkmem == NULL);
    }
@@ -1814,6 +1984,168 @@ void BMSdestroyBlockMemory_call(
    }
 }
 
+/** creates a chunk pool that can be shared between several block memories */
+BMS_CHKPOOL* BMScreateChunkPool_call(
+   long long             maxsize,            /**< maximal number of bytes that are kept in the pool */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   BMS_CHKPOOL* chunkpool;
+   int i;
+
+   BMSallocMemory(&chunkpool);
+   if( chunkpool == NULL )
+   {
+      printErrorHeader(filename, line);
+      printError("Insufficient memory for chunk pool.\n");
+      return NULL;
+   }
+
+#ifdef CHKPOOL_USELOCK
+   if( SCIPtpiInitLock(&chunkpool->lock) != SCIP_OKAY )
+   {
+      printErrorHeader(filename, line);
+      printError("Could not initialize lock of chunk pool.\n");
+      BMSfreeMemory(&chunkpool);
+      return NULL;
+   }
+#endif
+
+   for( i = 0; i < CHKPOOL_HASHSIZE; ++i )
+      chunkpool->blockhash[i] = NULL;
+   chunkpool->maxsize = MAX(maxsize, 0LL);
+   chunkpool->memsize = 0;
+   chunkpool->maxmemsize = 0;
+   chunkpool->nreused = 0;
+   chunkpool->nuses = 1;
+
+   return chunkpool;
+}
+
+/** releases a chunk pool; the pool and its memory are freed if it is not captured anymore */
+void BMSreleaseChunkPool_call(
+   BMS_CHKPOOL**         chunkpool,          /**< pointer to chunk pool */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   )
+{
+   POOLBLOCK* block;
+   int nuses;
+   int i;
+
+   assert(chunkpool != NULL);
+
+   if( *chunkpool == NULL )
+   {
+      printErrorHeader(filename, line);
+      printError("Tried to release null chunk pool.\n");
+      return;
+   }
+
+   chkpoolLock(*chunkpool);
+   assert((*chunkpool)->nuses > 0);
+   nuses = --(*chunkpool)->nuses;
+   chkpoolUnlock(*chunkpool);
+
+   if( nuses == 0 )
+   {
+      for( i = 0; i < CHKPOOL_HASHSIZE; ++i )
+      {
+         while( (*chunkpool)->blockhash[i] != NULL )
+         {
+            block = (*chunkpool)->blockhash[i];
+            (*chunkpool)->blockhash[i] = block->next;
+            BMSfreeMemory(&block);
+         }
+      }
+
+#ifdef CHKPOOL_USELOCK
+      SCIPtpiDestroyLock(&(*chunkpool)->lock);
+#endif
+      BMSfreeMemory(chunkpool);
+   }
+
+   *chunkpool = NULL;
+}
+
+/** attaches a chunk pool to the block memory, which then takes and returns its chunks from and to the pool;
+ *  the pool is captured by the block memory and released when the block memory is destroyed
+ *
+ *  @note the block memory and the pool must not be used by other threads while the pool is attached
+ */
+void BMSsetBlockMemoryChunkPool_call(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_CHKPOOL*          chunkpool           /**< chunk pool, or NULL to detach the current pool */
+   )
+{
+   BMS_CHKMEM* chkmem;
+   int i;
+
+   assert(blkmem != NULL);
+
+   if( chunkpool == blkmem->chunkpool )
+      return;
+
+   if( chunkpool != NULL )
+   {
+      chkpoolLock(chunkpool);
+      ++chunkpool->nuses;
+      chkpoolUnlock(chunkpool);
+   }
+
+   if( blkmem->chunkpool != NULL )
+      BMSreleaseChunkPool_call(&blkmem->chunkpool, __FILE__, __LINE__);
+
+   blkmem->chunkpool = chunkpool;
+
+   for( i = 0; i < CHKHASH_SIZE; ++i )
+   {
+      for( chkmem = blkmem->chkmemhash[i]; chkmem != NULL; chkmem = chkmem->nextchkmem )
+         chkmem->chunkpool = chunkpool;
+   }
+}
+
+/** returns the chunk pool attached to the block memory, or NULL */
+BMS_CHKPOOL* BMSgetBlockMemoryChunkPool_call(
+   const BMS_BLKMEM*     blkmem              /**< block memory */
+   )
+{
+   assert(blkmem != NULL);
+
+   return blkmem->chunkpool;
+}
+
+/** returns the number of bytes that are currently kept in the chunk pool */
+long long BMSgetChunkPoolMemory_call(
+   const BMS_CHKPOOL*    chunkpool           /**< chunk pool */
+   )
+{
+   assert(chunkpool != NULL);
+
+   return chunkpool->memsize;
+}
+
+/** returns the maximal number of bytes that were kept in the chunk pool */
+long long BMSgetChunkPoolMemoryMax_call(
+   const BMS_CHKPOOL*    chunkpool           /**< chunk pool */
+   )
+{
+   assert(chunkpool != NULL);
+
+   return chunkpool->maxmemsize;
+}
+
+/** returns the number of chunks that were reused from the chunk pool */
+long long BMSgetChunkPoolNReused_call(
+   const BMS_CHKPOOL*    chunkpool           /**< chunk pool */
+   )
+{
+   assert(chunkpool != NULL);
+
+   return chunkpool->nreused;
+}
+
 /** work for allocating memory in the block memory pool */
 INLINE static
 void* BMSallocBlockMemory_work(
@@ -1848,6 +2180,7 @@ void* BMSallocBlockMemory_work(
          printError("Insufficient memory for chunk block.\n");
          return NULL;
       }
+      (*chkmemptr)->chunkpool = blkmem->chunkpool;
 #ifndef NDEBUG
       BMSduplicateMemoryArray(&(*chkmemptr)->filename, filename, strlen(filename) + 1);
       (*chkmemptr)->line = line;
@@ -2708,22 +3041,24 @@ void* BMSallocBufferMemory_work(
    {
       size_t newsize;
 
-      /* enlarge buffer */
+      /* enlarge buffer: the content of an unused buffer does not need to be preserved (a clean buffer is all zero
+       * anyway), so the old memory is freed and new memory is allocated instead of reallocating, which would copy
+       * the stale content of the buffer
+       */
       newsize = calcMemoryGrowSize((size_t)buffer->arraygrowinit, buffer->arraygrowfac, size);
-      BMSreallocMemorySize(&buffer->data[bufnum], newsize);
+      assert( newsize > buffer->size[bufnum] );
+      BMSfreeMemoryNull(&buffer->data[bufnum]);
+      buffer->totalmem -= buffer->size[bufnum];
+      buffer->size[bufnum] = 0;
 
-      /* clear new memory */
       if( buffer->clean )
       {
-         char* tmpptr = (char*)(buffer->data[bufnum]);
-         size_t inc = buffer->size[bufnum] / sizeof(*tmpptr);
-         tmpptr += inc;
-
-         BMSclearMemorySize(tmpptr, newsize - buffer->size[bufnum]);
+         BMSallocClearMemorySize(&buffer->data[bufnum], newsize);
+      }
+      else
+      {
+         BMSallocMemorySize(&buffer->data[bufnum], newsize);
       }
-      assert( newsize > buffer->size[bufnum] );
-      buffer->totalmem += newsize - buffer->size[bufnum];
-      buffer->size[bufnum] = newsize;
 
       if ( buffer->data[bufnum] == NULL )
       {
@@ -2731,6 +3066,9 @@ void* BMSallocBufferMemory_work(
          printError("Insufficient memory for reallocating buffer storage.\n");
          return NULL;
       }
+
+      buffer->totalmem += newsize;
+      buffer->size[bufnum] = newsize;
    }
    assert( buffer->size[bufnum] >= size );
 
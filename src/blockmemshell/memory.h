@@ -428,6 +428,7 @@ long long BMSgetChunkMemoryUsed_call(
  ***********************************************************/
 
 typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of chunk blocks */
+typedef struct BMS_ChkPool BMS_CHKPOOL;         /**< pool of unused chunks that can be shared between block memories */
 
 #ifndef BMS_NOBLOCKMEM
 
@@ -473,6 +474,14 @@ typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of
 #define BMSdisplayBlockMemory(mem)            BMSdisplayBlockMemory_call(mem)
 #define BMSblockMemoryCheckEmpty(mem)         BMScheckEmptyBlockMemory_call(mem)
 
+#define BMScreateChunkPool(maxsize)           BMScreateChunkPool_call( (maxsize), __FILE__, __LINE__ )
+#define BMSreleaseChunkPool(pool)             BMSreleaseChunkPool_call( (pool), __FILE__, __LINE__ )
+#define BMSsetBlockMemoryChunkPool(mem,pool)  BMSsetBlockMemoryChunkPool_call( (mem), (pool) )
+#define BMSgetBlockMemoryChunkPool(mem)       BMSgetBlockMemoryChunkPool_call(mem)
+#define BMSgetChunkPoolMemory(pool)           BMSgetChunkPoolMemory_call(pool)
+#define BMSgetChunkPoolMemoryMax(pool)        BMSgetChunkPoolMemoryMax_call(pool)
+#define BMSgetChunkPoolNReused(pool)          BMSgetChunkPoolNReused_call(pool)
+
 #else
 
 /* block memory management mapped to standard memory management */
@@ -508,6 +517,14 @@ typedef struct BMS_BlkMem BMS_BLKMEM;           /**< block memory: collection of
 #define BMSdisplayBlockMemory(mem)                           SCIP_UNUSED(mem)
 #define BMSblockMemoryCheckEmpty(mem)                        (SCIP_UNUSED(mem), 0LL)
 
+#define BMScreateChunkPool(maxsize)                          (SCIP_UNUSED(maxsize), (BMS_CHKPOOL*)NULL)
+#define BMSreleaseChunkPool(pool)                            SCIP_UNUSED(pool)
+#define BMSsetBlockMemoryChunkPool(mem,pool)                 (SCIP_UNUSED(mem), SCIP_UNUSED(pool))
+#define BMSgetBlockMemoryChunkPool(mem)                      (SCIP_UNUSED(mem), (BMS_CHKPOOL*)NULL)
+#define BMSgetChunkPoolMemory(pool)                          (SCIP_UNUSED(pool), 0LL)
+#define BMSgetChunkPoolMemoryMax(pool)                       (SCIP_UNUSED(pool), 0LL)
+#define BMSgetChunkPoolNReused(pool)                         (SCIP_UNUSED(pool), 0LL)
+
 #endif
 
 
@@ -682,6 +699,57 @@ long long BMSgetBlockMemoryAllocatedMax_call(
    const BMS_BLKMEM*     blkmem              /**< block memory */
    );
 
+/** creates a chunk pool that can be shared between several block memories */
+SCIP_EXPORT
+BMS_CHKPOOL* BMScreateChunkPool_call(
+   long long             maxsize,            /**< maximal number of bytes that are kept in the pool */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** releases a chunk pool; the pool and its memory are freed if it is not captured anymore */
+SCIP_EXPORT
+void BMSreleaseChunkPool_call(
+   BMS_CHKPOOL**         chunkpool,          /**< pointer to chunk pool */
+   const char*           filename,           /**< source file of the function call */
+   int                   line                /**< line number in source file of the function call */
+   );
+
+/** attaches a chunk pool to the block memory, which then takes and returns its chunks from and to the pool;
+ *  the pool is captured by the block memory and released when the block memory is destroyed
+ *
+ *  @note the block memory and the pool must not be used by other threads while the pool is attached
+ */
+SCIP_EXPORT
+void BMSsetBlockMemoryChunkPool_call(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   BMS_CHKPOOL*          chunkpool           /**< chunk pool, or NULL to detach the current pool */
+   );
+
+/** returns the chunk pool attached to the block memory, or NULL */
+SCIP_EXPORT
+BMS_CHKPOOL* BMSgetBlockMemoryChunkPool_call(
+   const BMS_BLKMEM*     blkmem              /**< block memory */
+   );
+
+/** returns the number of bytes that are currently kept in the chunk pool */
+SCIP_EXPORT
+long long BMSgetChunkPoolMemory_call(
+   const BMS_CHKPOOL*    chunkpool           /**< chunk pool */
+   );
+
+/** returns the maximal number of bytes that were kept in the chunk pool */
+SCIP_EXPORT
+long long BMSgetChunkPoolMemoryMax_call(
+   const BMS_CHKPOOL*    chunkpool           /**< chunk pool */
+   );
+
+/** returns the number of chunks that were reused from the chunk pool */
+SCIP_EXPORT
+long long BMSgetChunkPoolNReused_call(
+   const BMS_CHKPOOL*    chunkpool           /**< chunk pool */
+   );
+
 /** returns the size of the given memory element; returns 0, if the element is not member of the block memory */
 SCIP_EXPORT
 size_t BMSgetBlockPointerSize_call(
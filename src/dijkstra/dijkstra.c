@@ -448,9 +448,10 @@ unsigned int dijkstraPairCutoff(
       assert( dijkstraHeapIsValid(entry, dist, order, used, G->nodes) );
       assert( entry[used] < G->nodes );
 
-      /* only work on nodes if their distance is less than the cutoff */
+      /* stop if the distance reached the cutoff; since the nodes leave the heap in nondecreasing order of their
+       * distances, the remaining nodes cannot be worked on either */
       if ( dist[tail] >= cutoff )
-         continue;
+         break;
 
       /* check adjacent nodes */
       for (e = G->outbeg[tail]; G->head[e] != DIJKSTRA_UNUSED; ++e)
@@ -562,9 +563,10 @@ unsigned int dijkstraPairCutoffIgnore(
       assert( dijkstraHeapIsValid(entry, dist, order, used, G->nodes) );
       assert( entry[used] < G->nodes );
 
-      /* only work on nodes if their distance is less than the cutoff */
+      /* stop if the distance reached the cutoff; since the nodes leave the heap in nondecreasing order of their
+       * distances, the remaining nodes cannot be worked on either */
       if ( dist[tail] >= cutoff )
-         continue;
+         break;
 
       /* check adjacent nodes */
       for (e = G->outbeg[tail]; G->head[e] != DIJKSTRA_UNUSED; ++e)
@@ -1922,7 +1922,8 @@ SCIP_RETCODE SCIPlpiAddCols(
    SPxSCIP* spx = lpi->spx;
    try
    {
-      LPColSet cols(ncols);
+      /* reserve the memory for all nonzeros at once instead of enlarging it column by column */
+      LPColSet cols(ncols, nnonz);
       DSVector colVector(ncols);
       int start;
       int last;
@@ -2054,7 +2055,8 @@ SCIP_RETCODE SCIPlpiAddRows(
    try
    {
       SPxSCIP* spx = lpi->spx;
-      LPRowSet rows(nrows);
+      /* reserve the memory for all nonzeros at once instead of enlarging it row by row */
+      LPRowSet rows(nrows, nnonz);
       DSVector rowVector;
       int start;
       int last;
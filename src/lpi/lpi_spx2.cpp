@@ -1275,7 +1275,8 @@ SCIP_RETCODE SCIPlpiAddCols(
    SPxSCIP* spx = lpi->spx;
    try
    {
-      LPColSet cols(ncols);
+      /* reserve the memory for all nonzeros at once instead of enlarging it column by column */
+      LPColSet cols(ncols, nnonz);
       DSVector colVector(ncols);
       int start;
       int last;
@@ -1407,7 +1408,8 @@ SCIP_RETCODE SCIPlpiAddRows(
    try
    {
       SPxSCIP* spx = lpi->spx;
-      LPRowSet rows(nrows);
+      /* reserve the memory for all nonzeros at once instead of enlarging it row by row */
+      LPRowSet rows(nrows, nnonz);
       DSVector rowVector;
       int start;
       int last;
@@ -3160,11 +3160,14 @@ SCIP_RETCODE solveBendersSubproblems(
    }
    else
    {
-      /* solving each of the subproblems for Benders' decomposition */
+      /* solving each of the subproblems for Benders' decomposition; the subproblems are handed out to the threads one
+       * at a time, since their solving times can differ a lot and with a static partition, all threads would wait for
+       * the thread with the slowest block of subproblems
+       */
       /* TODO: ensure that the each of the subproblems solve and update the parameters with the correct return values
        */
 #ifndef __INTEL_COMPILER
-      #pragma omp parallel for num_threads(numthreads) private(i) reduction(&&:locoptimal) reduction(||:locinfeasible) reduction(+:locnverified) reduction(||:locstopped) reduction(min:retcode)
+      #pragma omp parallel for num_threads(numthreads) schedule(dynamic, 1) private(i) reduction(&&:locoptimal) reduction(||:locinfeasible) reduction(+:locnverified) reduction(||:locstopped) reduction(min:retcode)
 #endif
       for( j = 0; j < nsolveidx; j++ )
       {
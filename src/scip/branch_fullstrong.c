@@ -55,6 +55,8 @@
 #define DEFAULT_PROBINGBOUNDS    TRUE        /**< should valid bounds be identified in a probing-like fashion during strong
                                               *   branching (only with propagation)? */
 #define DEFAULT_FORCESTRONGBRANCH FALSE      /**< should strong branching be applied even if there is just a single candidate? */
+#define DEFAULT_BATCHED          FALSE       /**< should all candidates be evaluated in a single batched strong branching call of
+                                              *   the LP solver (only without propagation)? */
 
 
 /** branching rule data */
@@ -67,6 +69,8 @@ struct SCIP_BranchruleData
    SCIP_Bool             probingbounds;      /**< should valid bounds be identified in a probing-like fashion during strong
                                               *   branching (only with propagation)? */
    SCIP_Bool             forcestrongbranch;  /**< should strong branching be applied even if there is just a single candidate? */
+   SCIP_Bool             batched;            /**< should all candidates be evaluated in a single batched strong branching call of
+                                              *   the LP solver (only without propagation)? */
    int                   lastcand;           /**< last evaluated candidate of last branching rule execution */
    int                   skipsize;           /**< size of skipdown and skipup array */
    SCIP_Bool*            skipdown;           /**< should be branching on down child be skipped? */
@@ -187,6 +191,18 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
    SCIP_VAR** vars = NULL;
    SCIP_Real* newlbs = NULL;
    SCIP_Real* newubs = NULL;
+   SCIP_VAR** batchvars = NULL;
+   SCIP_Real* batchdown = NULL;
+   SCIP_Real* batchup = NULL;
+   SCIP_Bool* batchdownvalid = NULL;
+   SCIP_Bool* batchupvalid = NULL;
+   SCIP_Bool* batchdowninf = NULL;
+   SCIP_Bool* batchupinf = NULL;
+   SCIP_Bool* batchdownconflict = NULL;
+   SCIP_Bool* batchupconflict = NULL;
+   int* batchpos = NULL;
+   SCIP_Bool batchlperror = FALSE;
+   int nbatchvars = 0;
    SCIP_BRANCHRULE* branchrule;
    SCIP_BRANCHRULEDATA* branchruledata;
    SCIP_Longint reevalage;
@@ -291,6 +307,63 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
     /* initialize strong branching */
    SCIP_CALL( SCIPstartStrongbranch(scip, propagate) );
 
+   /* in batched mode, all candidates that need to be evaluated are passed to the LP solver in a single call, such that
+    * LP solvers supporting batched strong branching can process them together; the results are evaluated afterwards
+    * in the same order as in the sequential mode, which keeps the pseudo cost updates deterministic
+    */
+   if( branchruledata->batched && !propagate )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchpos, nlpcands) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchvars, nlpcands) );
+
+      /* batchpos is -1 for candidates whose strong branching values can be reused, -2 for candidates that are not part
+       * of the batch and are evaluated one by one if the loop below reaches them, and the position in the batch otherwise;
+       * only the candidates the loop below evaluates with bothgains being TRUE are batched, and candidates for which both
+       * directions are skipped are left out
+       */
+      for( i = 0, c = *start; i < nlpcands; ++i, ++c )
+      {
+         c = c % nlpcands;
+
+         if( SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+            && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
+            batchpos[c] = -1;
+         else if( i >= ncomplete || (skipdown[i] && skipup[i]) )
+            batchpos[c] = -2;
+         else
+         {
+            batchpos[c] = nbatchvars;
+            batchvars[nbatchvars++] = lpcands[c];
+         }
+      }
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdown, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchup, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdownvalid, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchupvalid, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdowninf, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchupinf, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchdownconflict, nbatchvars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchupconflict, nbatchvars) );
+
+      if( nbatchvars > 0 )
+      {
+         SCIPdebugMsg(scip, "applying batched strong branching on %d variables\n", nbatchvars);
+
+         SCIP_CALL( SCIPgetVarsStrongbranchesFrac(scip, batchvars, nbatchvars, INT_MAX, batchdown, batchup,
+               batchdownvalid, batchupvalid, batchdowninf, batchupinf, batchdownconflict, batchupconflict,
+               &batchlperror) );
+
+         /* if the batched call failed, the candidates of the batch are evaluated one by one in the loop below, such that
+          * an error only affects the candidate for which it occurs
+          */
+         if( batchlperror )
+         {
+            SCIPdebugMsg(scip, "error in batched strong branching, evaluating the candidates one by one\n");
+         }
+      }
+   }
+
    /* search the full strong candidate
     * cycle through the candidates, starting with the position evaluated in the last run
     */
@@ -302,10 +375,10 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
       assert(lpcands[c] != NULL);
 
       /* don't use strong branching on variables that have already been initialized at the current node,
-       * and that were evaluated not too long ago
+       * and that were evaluated not too long ago; in batched mode, this was already decided before the batched call
        */
-      if( SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
-         && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage )
+      if( batchpos != NULL ? batchpos[c] == -1 : (SCIPgetVarStrongbranchNode(scip, lpcands[c]) == nodenum
+            && SCIPgetVarStrongbranchLPAge(scip, lpcands[c]) < reevalage) )
       {
          SCIP_Real lastlpobjval;
 
@@ -342,6 +415,24 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
             SCIPdebugMsg(scip, "-> down=%.9g (gain=%.9g, valid=%u, inf=%u, conflict=%u), up=%.9g (gain=%.9g, valid=%u, inf=%u, conflict=%u)\n",
                down, down - lpobjval, downvalid, downinf, downconflict, up, up - lpobjval, upvalid, upinf, upconflict);
          }
+         else if( batchpos != NULL && batchpos[c] >= 0 && !batchlperror )
+         {
+            int pos;
+
+            /* take the results of the batched strong branching call */
+            pos = batchpos[c];
+            assert(0 <= pos && pos < nbatchvars);
+
+            down = skipdown[i] ? -SCIPinfinity(scip) : batchdown[pos];
+            up = skipup[i] ? -SCIPinfinity(scip) : batchup[pos];
+            downvalid = !skipdown[i] && batchdownvalid[pos];
+            upvalid = !skipup[i] && batchupvalid[pos];
+            downinf = !skipdown[i] && batchdowninf[pos];
+            upinf = !skipup[i] && batchupinf[pos];
+            downconflict = !skipdown[i] && batchdownconflict[pos];
+            upconflict = !skipup[i] && batchupconflict[pos];
+            lperror = FALSE;
+         }
          else
          {
             SCIP_CALL( SCIPgetVarStrongbranchFrac(scip, lpcands[c], INT_MAX, FALSE,
@@ -517,6 +608,20 @@ SCIP_RETCODE SCIPselectVarStrongBranching(
 
    *start = c;
 
+   if( batchpos != NULL )
+   {
+      SCIPfreeBufferArray(scip, &batchupconflict);
+      SCIPfreeBufferArray(scip, &batchdownconflict);
+      SCIPfreeBufferArray(scip, &batchupinf);
+      SCIPfreeBufferArray(scip, &batchdowninf);
+      SCIPfreeBufferArray(scip, &batchupvalid);
+      SCIPfreeBufferArray(scip, &batchdownvalid);
+      SCIPfreeBufferArray(scip, &batchup);
+      SCIPfreeBufferArray(scip, &batchdown);
+      SCIPfreeBufferArray(scip, &batchvars);
+      SCIPfreeBufferArray(scip, &batchpos);
+   }
+
    if( probingbounds )
    {
       assert(newlbs != NULL);
@@ -691,6 +796,10 @@ SCIP_RETCODE SCIPincludeBranchruleFullstrong(
          "branching/fullstrong/forcestrongbranch",
          "should strong branching be applied even if there is just a single candidate?",
          &branchruledata->forcestrongbranch, TRUE, DEFAULT_FORCESTRONGBRANCH, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "branching/fullstrong/batched",
+         "should all candidates be evaluated in a single batched strong branching call of the LP solver (only without propagation)?",
+         &branchruledata->batched, TRUE, DEFAULT_BATCHED, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -40,6 +40,7 @@
 #include "scip/scip_heur.h"
 #include "scip/scip_mem.h"
 #include "scip/scip_message.h"
+#include "scip/scip_nodesel.h"
 #include "scip/scip_numerics.h"
 #include "scip/scip_param.h"
 #include "scip/scip_prob.h"
@@ -48,6 +49,7 @@
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_timing.h"
 #include "scip/syncstore.h"
+#include <limits.h>
 #include <string.h>
 
 /* event handler for synchronization */
@@ -58,12 +60,97 @@
  * Data structures
  */
 
+/** data for a concurrent solver type */
+struct SCIP_ConcSolverTypeData
+{
+   SCIP_Bool             loademphasis;       /**< should emphasis settings be loaded when creating an instance of this concurrent solver */
+   SCIP_PARAMEMPHASIS    emphasis;           /**< parameter emphasis that will be loaded if loademphasis is true */
+};
+
+/** data for a concurrent solver */
+struct SCIP_ConcSolverData
+{
+   SCIP*                 solverscip;         /**< the concurrent solvers private SCIP datastructure */
+   SCIP_VAR**            vars;               /**< array of variables in the order of the main SCIP's variable array */
+   int                   nvars;              /**< number of variables in the above arrays */
+};
+
 /** event handler data */
 struct SCIP_EventhdlrData
 {
    int             filterpos;
+   int             asyncfilterpos;           /**< filter position for the events of the solution slot, or -1 */
+   SCIP_CONCSOLVER* concsolver;              /**< the concurrent solver the event handler belongs to */
+   SCIP_Longint    asyncsolnum;              /**< number of the last solution read from the solution slot */
 };
 
+/** publishes a new incumbent in the solution slot of the synchronization store */
+static
+SCIP_RETCODE publishAsyncSol(
+   SCIP*                 scip,               /**< SCIP data structure of the concurrent solver */
+   SCIP_EVENTHDLRDATA*   eventhdlrdata,      /**< event handler data */
+   SCIP_SOL*             sol                 /**< the new incumbent */
+   )
+{
+   SCIP_CONCSOLVERDATA* data;
+   SCIP_Real* solvals;
+
+   data = SCIPconcsolverGetData(eventhdlrdata->concsolver);
+   assert(data != NULL);
+
+   /* gather the solution values before locking the solution slot, so that the lock is never held across calls that
+    * may fail
+    */
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, data->nvars) );
+   SCIP_CALL( SCIPgetSolVals(scip, sol, data->nvars, data->vars, solvals) );
+
+   SCIP_CALL( SCIPsyncstorePublishSol(SCIPgetSyncstore(scip), SCIPgetSolOrigObj(scip, sol),
+         SCIPconcsolverGetIdx(eventhdlrdata->concsolver), solvals, data->nvars, NULL) );
+
+   SCIPfreeBufferArray(scip, &solvals);
+
+   return SCIP_OKAY;
+}
+
+/** passes the solution of the solution slot of the synchronization store to the sync heuristic if it is new and
+ *  improves the primal bound
+ */
+static
+SCIP_RETCODE readAsyncSol(
+   SCIP*                 scip,               /**< SCIP data structure of the concurrent solver */
+   SCIP_EVENTHDLRDATA*   eventhdlrdata       /**< event handler data */
+   )
+{
+   SCIP_CONCSOLVERDATA* data;
+   SCIP_Real* solvals;
+   SCIP_Real solobj;
+   SCIP_Bool found;
+
+   data = SCIPconcsolverGetData(eventhdlrdata->concsolver);
+   assert(data != NULL);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, data->nvars) );
+
+   SCIP_CALL( SCIPsyncstoreReadPublishedSol(SCIPgetSyncstore(scip), SCIPconcsolverGetIdx(eventhdlrdata->concsolver),
+         SCIPgetPrimalbound(scip), &eventhdlrdata->asyncsolnum, solvals, &solobj, &found) );
+
+   if( found )
+   {
+      SCIP_SOL* newsol;
+
+      SCIPdebugMessage("adding solution with objective %g from solution slot in concurrent solver %s\n", solobj,
+         SCIPconcsolverGetName(eventhdlrdata->concsolver));
+
+      SCIP_CALL( SCIPcreateOrigSol(scip, &newsol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, newsol, data->nvars, data->vars, solvals) );
+      SCIP_CALL( SCIPaddConcurrentSol(scip, newsol) );
+   }
+
+   SCIPfreeBufferArray(scip, &solvals);
+
+   return SCIP_OKAY;
+}
+
 /*
  * Callback methods of event handler
  */
@@ -111,6 +198,14 @@ SCIP_DECL_EVENTINIT(eventInitSync)
       SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_SYNC, eventhdlr, NULL, &eventhdlrdata->filterpos) );
    }
 
+   /* new incumbents are published in the solution slot and the slot is checked whenever a node is focused */
+   if( eventhdlrdata->asyncfilterpos < 0 && eventhdlrdata->concsolver != NULL && SCIPsyncstoreUsesAsyncSols(syncstore) )
+   {
+      eventhdlrdata->asyncsolnum = 0;
+      SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_NODEFOCUSED, eventhdlr, NULL,
+            &eventhdlrdata->asyncfilterpos) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -134,6 +229,13 @@ SCIP_DECL_EVENTEXIT(eventExitSync)
       eventhdlrdata->filterpos = -1;
    }
 
+   if( eventhdlrdata->asyncfilterpos >= 0 )
+   {
+      SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_NODEFOCUSED, eventhdlr, NULL,
+            eventhdlrdata->asyncfilterpos) );
+      eventhdlrdata->asyncfilterpos = -1;
+   }
+
    return SCIP_OKAY;
 }
 
@@ -146,7 +248,18 @@ SCIP_DECL_EVENTEXEC(eventExecSync)
    assert(event != NULL);
    assert(scip != NULL);
 
-   SCIP_CALL( SCIPsynchronize(scip) );
+   if( SCIPeventGetType(event) == SCIP_EVENTTYPE_BESTSOLFOUND )
+   {
+      SCIP_CALL( publishAsyncSol(scip, SCIPeventhdlrGetData(eventhdlr), SCIPeventGetSol(event)) );
+   }
+   else if( SCIPeventGetType(event) == SCIP_EVENTTYPE_NODEFOCUSED )
+   {
+      SCIP_CALL( readAsyncSol(scip, SCIPeventhdlrGetData(eventhdlr)) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPsynchronize(scip) );
+   }
 
    return SCIP_OKAY;
 }
@@ -155,7 +268,8 @@ SCIP_DECL_EVENTEXEC(eventExecSync)
 /** includes event handler for synchronization found */
 static
 SCIP_RETCODE includeEventHdlrSync(
-   SCIP*                 scip                /**< SCIP data structure */
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONCSOLVER*      concsolver          /**< the concurrent solver the event handler belongs to */
    )
 {
    SCIP_EVENTHDLR*     eventhdlr;
@@ -163,6 +277,9 @@ SCIP_RETCODE includeEventHdlrSync(
 
    SCIP_CALL( SCIPallocBlockMemory(scip, &eventhdlrdata) );
    eventhdlrdata->filterpos = -1;
+   eventhdlrdata->asyncfilterpos = -1;
+   eventhdlrdata->concsolver = concsolver;
+   eventhdlrdata->asyncsolnum = 0;
 
    /* create event handler for events on watched variables */
    SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC, eventExecSync, eventhdlrdata) );
@@ -175,21 +292,6 @@ SCIP_RETCODE includeEventHdlrSync(
    return SCIP_OKAY;
 }
 
-/** data for a concurrent solver type */
-struct SCIP_ConcSolverTypeData
-{
-   SCIP_Bool             loademphasis;       /**< should emphasis settings be loaded when creating an instance of this concurrent solver */
-   SCIP_PARAMEMPHASIS    emphasis;           /**< parameter emphasis that will be loaded if loademphasis is true */
-};
-
-/** data for a concurrent solver */
-struct SCIP_ConcSolverData
-{
-   SCIP*                 solverscip;         /**< the concurrent solvers private SCIP datastructure */
-   SCIP_VAR**            vars;               /**< array of variables in the order of the main SCIP's variable array */
-   int                   nvars;              /**< number of variables in the above arrays */
-};
-
 /** Disable dual reductions that might cut off optimal solutions. Although they keep at least
  *  one optimal solution intact, communicating these bounds may cut off all optimal solutions,
  *  if different optimal solutions were kept in different concurrent solvers. */
@@ -228,6 +330,80 @@ SCIP_RETCODE setChildSelRule(
    return SCIP_OKAY;
 }
 
+/** sets the node selection rule based on the index of the concurrent solver
+ *
+ *  The first solver keeps the default node selector. All other solvers move one of the remaining standard node
+ *  selectors to the highest standard priority, such that the solvers explore different parts of the search tree
+ *  instead of reproducing the same tree.
+ */
+static
+SCIP_RETCODE setNodeSelRule(
+   SCIP_CONCSOLVER*      concsolver          /**< the concurrent solver */
+   )
+{
+   SCIP_CONCSOLVERDATA*  data;
+   SCIP_NODESEL*         nodesel;
+   static const char*    nodeselnames[] = { "bfs", "hybestim", "restartdfs", "dfs" };
+   int                   idx;
+
+   assert(concsolver != NULL);
+
+   data = SCIPconcsolverGetData(concsolver);
+   assert(data != NULL);
+
+   idx = SCIPconcsolverGetIdx(concsolver);
+
+   if( idx == 0 )
+      return SCIP_OKAY;
+
+   nodesel = SCIPfindNodesel(data->solverscip, nodeselnames[(idx - 1) % 4]);
+
+   /* node selector might not be included, e.g., if the plugins were not copied */
+   if( nodesel == NULL )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetNodeselStdPriority(data->solverscip, nodesel, INT_MAX / 4) );
+
+   return SCIP_OKAY;
+}
+
+/** lets the block memory of the concurrent solver take and return its chunks from and to a chunk pool that is shared
+ *  with the main SCIP and all other concurrent solvers, such that memory freed in one solver can be reused by another
+ */
+static
+SCIP_RETCODE attachChunkPool(
+   SCIP*                 scip,               /**< the main SCIP instance */
+   SCIP*                 solverscip          /**< the concurrent solver's SCIP instance */
+   )
+{
+   BMS_CHKPOOL* chunkpool;
+   SCIP_Real poolsize;
+
+   SCIP_CALL( SCIPgetRealParam(scip, "concurrent/chunkpoolsize", &poolsize) );
+
+   if( poolsize <= 0.0 )
+      return SCIP_OKAY;
+
+   /* the pool is created with the first concurrent solver and kept by the block memory of the main SCIP */
+   chunkpool = BMSgetBlockMemoryChunkPool(SCIPblkmem(scip));
+   if( chunkpool == NULL )
+   {
+      chunkpool = BMScreateChunkPool((long long)(poolsize * 1048576.0));
+
+      /* if block memory is disabled, there is nothing to share */
+      if( chunkpool == NULL )
+         return SCIP_OKAY;
+
+      BMSsetBlockMemoryChunkPool(SCIPblkmem(scip), chunkpool);
+      BMSreleaseChunkPool(&chunkpool);
+      chunkpool = BMSgetBlockMemoryChunkPool(SCIPblkmem(scip));
+   }
+
+   BMSsetBlockMemoryChunkPool(SCIPblkmem(solverscip), chunkpool);
+
+   return SCIP_OKAY;
+}
+
 /** initialize the concurrent SCIP solver, i.e. setup the copy of the problem and the
  *  mapping of the variables */
 static
@@ -254,6 +430,7 @@ SCIP_RETCODE initConcsolver(
 
    /* create the concurrent solver's SCIP instance and set up the problem */
    SCIP_CALL( SCIPcreate(&data->solverscip) );
+   SCIP_CALL( attachChunkPool(scip, data->solverscip) );
    SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(data->solverscip), data->nvars) );
    SCIP_CALL( SCIPcopy(scip, data->solverscip, varmapfw, NULL, SCIPconcsolverGetName(concsolver), TRUE, FALSE, FALSE,
          FALSE, &valid) );
@@ -317,6 +494,7 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    char*                    prefix;
    char                     filename[SCIP_MAXSTRLEN];
    SCIP_Bool                changechildsel;
+   SCIP_Bool                changenodesel;
 
    assert(scip != NULL);
    assert(concsolvertype != NULL);
@@ -388,7 +566,7 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
    }
 
    /* include eventhandler for synchronization */
-   SCIP_CALL( includeEventHdlrSync(data->solverscip) );
+   SCIP_CALL( includeEventHdlrSync(data->solverscip, concsolver) );
 
    /* disable output for subscip */
    SCIP_CALL( SCIPsetIntParam(data->solverscip, "display/verblevel", 0) );
@@ -412,6 +590,13 @@ SCIP_DECL_CONCSOLVERCREATEINST(concsolverScipCreateInstance)
       SCIP_CALL( setChildSelRule(concsolver) );
    }
 
+   /* set different node selection rules if corresponding parameter is TRUE */
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/changenodesel", &changenodesel) );
+   if( changenodesel )
+   {
+      SCIP_CALL( setNodeSelRule(concsolver) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -708,16 +893,16 @@ SCIP_DECL_CONCSOLVERSYNCREAD(concsolverScipSyncRead)
 
       /* cannot change bounds of multi-aggregated variables so dont pass this bound-change to the propagator */
       if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_MULTAGGR )
-         return SCIP_OKAY;
+         continue;
 
       /* if bound is not better than also don't pass this bound to the propagator and
        * don't waste memory for storing this boundchange
        */
       if( boundtype == SCIP_BOUNDTYPE_LOWER && SCIPisGE(data->solverscip, SCIPvarGetLbGlobal(var), newbound) )
-         return SCIP_OKAY;
+         continue;
 
       if( boundtype == SCIP_BOUNDTYPE_UPPER && SCIPisLE(data->solverscip, SCIPvarGetUbGlobal(var), newbound) )
-         return SCIP_OKAY;
+         continue;
 
       /* bound is better so incremented counters for statistics and pass it to the sync propagator */
       ++(*ntighterbnds);
@@ -1555,35 +1555,34 @@ SCIP_RETCODE conflictsetAddBound(
    assert((int)boundtype == 0 || (int)boundtype == 1);
    sortval = 2*idx + (int)boundtype; /* first sorting criteria: variable index, second criteria: boundtype */
 
-   /* insert new element into the sorted arrays; if an element exits with the same value insert the new element afterwards
-    *
-    * @todo check if it better (faster) to first search for the position O(log n) and compare the sort values and if
-    *       they are equal just replace the element and if not run the insert method O(n)
+   /* search for a bound change on the same variable and bound type in O(log n); if there is such a bound change, the
+    * two bound changes are merged in place, otherwise the new bound change is inserted into the sorted arrays
     */
-
-   SCIPsortedvecInsertIntPtrReal(sortvals, (void**)bdchginfos, relaxedbds, sortval, (void*)bdchginfo, relaxedbd, &conflictset->nbdchginfos, &pos);
-   assert(pos == conflictset->nbdchginfos - 1 || sortval < sortvals[pos+1]);
-
-   /* merge multiple bound changes */
-   if( pos > 0 && sortval == sortvals[pos-1] )
+   if( SCIPsortedvecFindInt(sortvals, sortval, conflictset->nbdchginfos, &pos) )
    {
       /* this is a multiple bound change */
-      if( SCIPbdchginfoIsTighter(bdchginfo, bdchginfos[pos-1]) )
-      {
-         /* remove the "old" bound change since the "new" one in tighter */
-         SCIPsortedvecDelPosIntPtrReal(sortvals, (void**)bdchginfos, relaxedbds, pos-1, &conflictset->nbdchginfos);
-      }
-      else if( SCIPbdchginfoIsTighter(bdchginfos[pos-1], bdchginfo) )
+      assert(sortvals[pos] == sortval);
+      assert(pos == 0 || sortvals[pos-1] < sortval);
+      assert(pos == conflictset->nbdchginfos - 1 || sortval < sortvals[pos+1]);
+
+      if( SCIPbdchginfoIsTighter(bdchginfo, bdchginfos[pos]) )
       {
-         /* remove the "new"  bound change since the "old" one is tighter */
-         SCIPsortedvecDelPosIntPtrReal(sortvals, (void**)bdchginfos, relaxedbds, pos, &conflictset->nbdchginfos);
+         /* replace the "old" bound change since the "new" one in tighter */
+         bdchginfos[pos] = bdchginfo;
+         relaxedbds[pos] = relaxedbd;
       }
-      else
+      else if( !SCIPbdchginfoIsTighter(bdchginfos[pos], bdchginfo) )
       {
-         /* both bound change are equivalent; hence, keep the worse relaxed bound and remove one of them */
-         relaxedbds[pos-1] = boundtype == SCIP_BOUNDTYPE_LOWER ? MAX(relaxedbds[pos-1], relaxedbd) : MIN(relaxedbds[pos-1], relaxedbd);
-         SCIPsortedvecDelPosIntPtrReal(sortvals, (void**)bdchginfos, relaxedbds, pos, &conflictset->nbdchginfos);
+         /* both bound change are equivalent; hence, keep the worse relaxed bound and the "old" bound change */
+         relaxedbds[pos] = boundtype == SCIP_BOUNDTYPE_LOWER ? MAX(relaxedbds[pos], relaxedbd) : MIN(relaxedbds[pos], relaxedbd);
       }
+      /* otherwise, the "old" bound change is tighter and the "new" one is dropped */
+   }
+   else
+   {
+      SCIPsortedvecInsertIntPtrReal(sortvals, (void**)bdchginfos, relaxedbds, sortval, (void*)bdchginfo, relaxedbd, &conflictset->nbdchginfos, &pos);
+      assert(pos == 0 || sortvals[pos-1] < sortval);
+      assert(pos == conflictset->nbdchginfos - 1 || sortval < sortvals[pos+1]);
    }
 
    if( SCIPvarIsRelaxationOnly(var) )
@@ -5871,6 +5871,7 @@ SCIP_RETCODE SCIPconsCreate(
    (*cons)->age = 0.0;
    (*cons)->nuses = 0;
    (*cons)->nupgradelocks = 0;
+   (*cons)->sharedname = FALSE;
    (*cons)->initial = initial;
    (*cons)->separate = separate;
    (*cons)->enforce = enforce;
@@ -6121,7 +6122,10 @@ SCIP_RETCODE SCIPconsChgName(
    assert(cons->name != NULL);
 
    /* free old constraint name */
-   BMSfreeBlockMemoryArray(blkmem, &cons->name, strlen(cons->name)+1);
+   if( cons->sharedname )
+      cons->sharedname = FALSE;
+   else
+      BMSfreeBlockMemoryArray(blkmem, &cons->name, strlen(cons->name)+1);
 
    /* copy new constraint name */
    SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &cons->name, name, strlen(name)+1) );
@@ -6179,7 +6183,8 @@ SCIP_RETCODE SCIPconsFree(
    assert((*cons)->consspos == -1);
 
    /* free constraint */
-   BMSfreeBlockMemoryArray(blkmem, &(*cons)->name, strlen((*cons)->name)+1);
+   if( !(*cons)->sharedname )
+      BMSfreeBlockMemoryArray(blkmem, &(*cons)->name, strlen((*cons)->name)+1);
    BMSfreeBlockMemory(blkmem, cons);
 
    return SCIP_OKAY;
@@ -6442,6 +6447,17 @@ SCIP_RETCODE SCIPconsTransform(
                FALSE, FALSE) );
       }
 
+      /* the transformed constraint usually has the same name as the original one; in this case, it points to the name
+       * of the original constraint instead of keeping its own copy, which is valid since the original constraint cannot
+       * be freed before the transformed constraint
+       */
+      if( !(*transcons)->sharedname && strcmp((*transcons)->name, origcons->name) == 0 )
+      {
+         BMSfreeBlockMemoryArray(blkmem, &(*transcons)->name, strlen((*transcons)->name)+1);
+         (*transcons)->name = origcons->name;
+         (*transcons)->sharedname = TRUE;
+      }
+
       /* link original and transformed constraint */
       origcons->transorigcons = *transcons;
       (*transcons)->transorigcons = origcons;
@@ -5598,6 +5598,40 @@ SCIP_RETCODE SCIPseparateKnapsackCuts(
    /* gets solution values of all problem variables */
    SCIP_CALL( SCIPgetSolVals(scip, sol, nvars, vars, solvals) );
 
+   /* all covers computed below contain only variables with positive solution value and need a fractional variable;
+    * if the weights of these variables do not exceed the capacity or the solution is integral on the knapsack
+    * variables, no cover can be found and we skip the separation routines (unless some weight exceeds the capacity,
+    * because then getCover() tightens the upper bound of the corresponding variable)
+    */
+   {
+      SCIP_Longint posweight;
+      SCIP_Bool hasfractional;
+      int i;
+
+      posweight = 0;
+      hasfractional = FALSE;
+      for( i = 0; i < nvars; ++i )
+      {
+         if( weights[i] > capacity )
+            break;
+
+         if( !SCIPisFeasEQ(scip, solvals[i], 0.0) )
+         {
+            posweight += weights[i];
+
+            if( !SCIPisFeasEQ(scip, solvals[i], 1.0) )
+               hasfractional = TRUE;
+         }
+      }
+
+      if( i == nvars && (!hasfractional || posweight <= capacity) )
+      {
+         SCIPdebugMsg(scip, "   no cover for knapsack constraint <%s>: %s\n", cons == NULL ? "-" : SCIPconsGetName(cons),
+            hasfractional ? "weight of variables with positive value does not exceed capacity" : "solution is integral");
+         goto TERMINATE;
+      }
+   }
+
 #ifdef SCIP_DEBUG
    {
       int i;
@@ -894,12 +894,11 @@ SCIP_RETCODE consdataCreate(
    {
       int k;
 
-      SCIP_VAR** varsbuffer;
-      SCIP_Real* valsbuffer;
-
-      /* copy variables into temporary buffer */
-      SCIP_CALL( SCIPallocBufferArray(scip, &varsbuffer, nvars) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &valsbuffer, nvars) );
+      /* allocate the arrays for all given entries and copy the nonzero entries directly into them; if entries of fixed
+       * variables or with zero coefficient are sorted out, the arrays are shrunk to the kept entries below
+       */
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*consdata)->vars, nvars) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*consdata)->vals, nvars) );
       k = 0;
 
       /* loop over variables and sort out fixed ones */
@@ -921,8 +920,8 @@ SCIP_RETCODE consdataCreate(
             }
             else
             {
-               varsbuffer[k] = var;
-               valsbuffer[k] = val;
+               (*consdata)->vars[k] = var;
+               (*consdata)->vals[k] = val;
                k++;
 
                /* update hascontvar and hasnonbinvar flags */
@@ -943,16 +942,20 @@ SCIP_RETCODE consdataCreate(
       }
       (*consdata)->nvars = k;
 
-      if( k > 0 )
+      if( k == 0 )
+      {
+         SCIPfreeBlockMemoryArray(scip, &(*consdata)->vals, nvars);
+         SCIPfreeBlockMemoryArray(scip, &(*consdata)->vars, nvars);
+      }
+      else
       {
-         /* copy the possibly reduced buffer arrays into block */
-         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*consdata)->vars, varsbuffer, k) );
-         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*consdata)->vals, valsbuffer, k) );
+         if( k < nvars )
+         {
+            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*consdata)->vars, nvars, k) );
+            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*consdata)->vals, nvars, k) );
+         }
          (*consdata)->varssize = k;
       }
-      /* free temporary buffer */
-      SCIPfreeBufferArray(scip, &valsbuffer);
-      SCIPfreeBufferArray(scip, &varsbuffer);
    }
 
    (*consdata)->eventdata = NULL;
@@ -13567,9 +13570,6 @@ SCIP_RETCODE preprocessConstraintPairs(
 
       assert(consdata1->nvars >= 1);
 
-      /* sort the constraint */
-      SCIP_CALL( consdataSort(scip, consdata1) );
-
       /* calculate bit signatures of cons1 for potentially positive and negative coefficients */
       consdataCalcSignatures(consdata1);
       possignature1 = consdata1->possignature;
@@ -13592,10 +13592,21 @@ SCIP_RETCODE preprocessConstraintPairs(
          && ((negsignature0 | negsignature1) == negsignature0); /* negsignature0 >= negsignature1 (as bit vector) */
       cons1isequality = SCIPisEQ(scip, consdata1->lhs, consdata1->rhs);
       tryaggregation = (cons0isequality || cons1isequality) && (maxaggrnormscale > 0.0);
+
+      /* an aggregation needs a common variable; since each variable that is not fixed to zero sets its bit in one of
+       * the signatures, the constraints have no such common variable if the signatures are disjoint, and we can skip
+       * the aggregation without sorting and merging the variable lists
+       */
+      if( tryaggregation && ((possignature0 | negsignature0) & (possignature1 | negsignature1)) == 0 )
+         tryaggregation = FALSE;
+
       if( !cons0dominateslhs && !cons1dominateslhs && !cons0dominatesrhs && !cons1dominatesrhs
          && !coefsequal && !coefsnegated && !tryaggregation )
          continue;
 
+      /* sort the constraint */
+      SCIP_CALL( consdataSort(scip, consdata1) );
+
       /* make sure, we have enough memory for the index set of V_1 \ V_0 */
       if( tryaggregation && consdata1->nvars > diffidx1minus0size )
       {
@@ -17980,6 +17991,111 @@ SCIP_RETCODE SCIPcreateConsLinear(
    return SCIP_OKAY;
 }
 
+/** creates and captures several linear constraints at once from a matrix in compressed sparse row format
+ *
+ *  The entries of constraint c are stored at positions beg[c], ..., beg[c+1] - 1 of the arrays vars and vals. All
+ *  constraints get the same constraint flags; see SCIPcreateConsLinear() for their meaning. The constraints are created
+ *  one after the other in the same way as by SCIPcreateConsLinear(), so this function is a convenience for callers that
+ *  store their constraints as a sparse matrix and not a faster way of creating them.
+ *
+ *  @note the constraints get captured, hence at one point you have to release them using the method SCIPreleaseCons()
+ */
+SCIP_RETCODE SCIPcreateConssLinear(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< array to store the created constraints (of size nconss) */
+   int                   nconss,             /**< number of constraints to create */
+   const char**          names,              /**< names of the constraints */
+   int*                  beg,                /**< start positions of the constraints in vars and vals (of size nconss + 1) */
+   SCIP_VAR**            vars,               /**< array with variables of all constraint entries */
+   SCIP_Real*            vals,               /**< array with coefficients of all constraint entries */
+   SCIP_Real*            lhss,               /**< left hand sides of the constraints */
+   SCIP_Real*            rhss,               /**< right hand sides of the constraints */
+   SCIP_Bool             initial,            /**< should the LP relaxation of the constraints be in the initial LP?
+                                              *   Usually set to TRUE. Set to FALSE for 'lazy constraints'. */
+   SCIP_Bool             separate,           /**< should the constraints be separated during LP processing?
+                                              *   Usually set to TRUE. */
+   SCIP_Bool             enforce,            /**< should the constraints be enforced during node processing?
+                                              *   TRUE for model constraints, FALSE for additional, redundant constraints. */
+   SCIP_Bool             check,              /**< should the constraints be checked for feasibility?
+                                              *   TRUE for model constraints, FALSE for additional, redundant constraints. */
+   SCIP_Bool             propagate,          /**< should the constraints be propagated during node processing?
+                                              *   Usually set to TRUE. */
+   SCIP_Bool             local,              /**< are the constraints only valid locally?
+                                              *   Usually set to FALSE. Has to be set to TRUE, e.g., for branching constraints. */
+   SCIP_Bool             modifiable,         /**< are the constraints modifiable (subject to column generation)?
+                                              *   Usually set to FALSE. In column generation applications, set to TRUE if pricing
+                                              *   adds coefficients to these constraints. */
+   SCIP_Bool             dynamic,            /**< are the constraints subject to aging?
+                                              *   Usually set to FALSE. Set to TRUE for own cuts which
+                                              *   are separated as constraints. */
+   SCIP_Bool             removable,          /**< should the relaxations be removed from the LP due to aging or cleanup?
+                                              *   Usually set to FALSE. Set to TRUE for 'lazy constraints' and 'user cuts'. */
+   SCIP_Bool             stickingatnode      /**< should the constraints always be kept at the node where they were added, even
+                                              *   if they may be moved to a more global node?
+                                              *   Usually set to FALSE. Set to TRUE to for constraints that represent node data. */
+   )
+{
+   SCIP_CONSHDLR* conshdlr;
+   int c;
+
+   assert(scip != NULL);
+   assert(nconss == 0 || (conss != NULL && names != NULL && lhss != NULL && rhss != NULL));
+   assert(beg != NULL);
+   assert(beg[0] == 0);
+   assert(beg[nconss] == 0 || (vars != NULL && vals != NULL));
+
+   /* find the linear constraint handler */
+   conshdlr = SCIPfindConshdlr(scip, CONSHDLR_NAME);
+   if( conshdlr == NULL )
+   {
+      SCIPerrorMessage("linear constraint handler not found\n");
+      return SCIP_PLUGINNOTFOUND;
+   }
+
+   /* after presolving, the constraints have to contain active variables; this is ensured by SCIPcreateConsLinear() */
+   if( SCIPgetStage(scip) >= SCIP_STAGE_EXITPRESOLVE )
+   {
+      for( c = 0; c < nconss; ++c )
+      {
+         assert(beg[c] <= beg[c+1]);
+
+         SCIP_CALL( SCIPcreateConsLinear(scip, &conss[c], names[c], beg[c+1] - beg[c], vars + beg[c], vals + beg[c],
+               lhss[c], rhss[c], initial, separate, enforce, check, propagate, local, modifiable, dynamic, removable,
+               stickingatnode) );
+      }
+
+      return SCIP_OKAY;
+   }
+
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_CONSDATA* consdata;
+
+      assert(beg[c] <= beg[c+1]);
+
+      /* create constraint data */
+      SCIP_CALL( consdataCreate(scip, &consdata, beg[c+1] - beg[c], beg[c+1] > beg[c] ? vars + beg[c] : NULL,
+            beg[c+1] > beg[c] ? vals + beg[c] : NULL, lhss[c], rhss[c]) );
+      assert(consdata != NULL);
+
+#ifndef NDEBUG
+      /* if this is a checked or enforced constraints, then there must be no relaxation-only variables */
+      if( check || enforce )
+      {
+         int n;
+         for(n = consdata->nvars - 1; n >= 0; --n )
+            assert(!SCIPvarIsRelaxationOnly(consdata->vars[n]));
+      }
+#endif
+
+      /* create constraint */
+      SCIP_CALL( SCIPcreateCons(scip, &conss[c], names[c], conshdlr, consdata, initial, separate, enforce, check,
+            propagate, local, modifiable, dynamic, removable, stickingatnode) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** creates and captures a linear constraint
  *  in its most basic version, i. e., all constraint flags are set to their basic value as explained for the
  *  method SCIPcreateConsLinear(); all flags can be set via SCIPsetConsFLAGNAME-methods in scip.h
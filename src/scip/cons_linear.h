@@ -161,6 +161,51 @@ SCIP_RETCODE SCIPcreateConsLinear(
                                               *   Usually set to FALSE. Set to TRUE to for constraints that represent node data. */
    );
 
+/** creates and captures several linear constraints at once from a matrix in compressed sparse row format
+ *
+ *  The entries of constraint c are stored at positions beg[c], ..., beg[c+1] - 1 of the arrays vars and vals. All
+ *  constraints get the same constraint flags; see SCIPcreateConsLinear() for their meaning. The constraints are created
+ *  one after the other in the same way as by SCIPcreateConsLinear(), so this function is a convenience for callers that
+ *  store their constraints as a sparse matrix and not a faster way of creating them.
+ *
+ *  @note the constraints get captured, hence at one point you have to release them using the method SCIPreleaseCons()
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateConssLinear(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< array to store the created constraints (of size nconss) */
+   int                   nconss,             /**< number of constraints to create */
+   const char**          names,              /**< names of the constraints */
+   int*                  beg,                /**< start positions of the constraints in vars and vals (of size nconss + 1) */
+   SCIP_VAR**            vars,               /**< array with variables of all constraint entries */
+   SCIP_Real*            vals,               /**< array with coefficients of all constraint entries */
+   SCIP_Real*            lhss,               /**< left hand sides of the constraints */
+   SCIP_Real*            rhss,               /**< right hand sides of the constraints */
+   SCIP_Bool             initial,            /**< should the LP relaxation of the constraints be in the initial LP?
+                                              *   Usually set to TRUE. Set to FALSE for 'lazy constraints'. */
+   SCIP_Bool             separate,           /**< should the constraints be separated during LP processing?
+                                              *   Usually set to TRUE. */
+   SCIP_Bool             enforce,            /**< should the constraints be enforced during node processing?
+                                              *   TRUE for model constraints, FALSE for additional, redundant constraints. */
+   SCIP_Bool             check,              /**< should the constraints be checked for feasibility?
+                                              *   TRUE for model constraints, FALSE for additional, redundant constraints. */
+   SCIP_Bool             propagate,          /**< should the constraints be propagated during node processing?
+                                              *   Usually set to TRUE. */
+   SCIP_Bool             local,              /**< are the constraints only valid locally?
+                                              *   Usually set to FALSE. Has to be set to TRUE, e.g., for branching constraints. */
+   SCIP_Bool             modifiable,         /**< are the constraints modifiable (subject to column generation)?
+                                              *   Usually set to FALSE. In column generation applications, set to TRUE if pricing
+                                              *   adds coefficients to these constraints. */
+   SCIP_Bool             dynamic,            /**< are the constraints subject to aging?
+                                              *   Usually set to FALSE. Set to TRUE for own cuts which
+                                              *   are separated as constraints. */
+   SCIP_Bool             removable,          /**< should the relaxations be removed from the LP due to aging or cleanup?
+                                              *   Usually set to FALSE. Set to TRUE for 'lazy constraints' and 'user cuts'. */
+   SCIP_Bool             stickingatnode      /**< should the constraints always be kept at the node where they were added, even
+                                              *   if they may be moved to a more global node?
+                                              *   Usually set to FALSE. Set to TRUE to for constraints that represent node data. */
+   );
+
 /** creates and captures a linear constraint
  *  in its most basic version, i. e., all constraint flags are set to their basic value as explained for the
  *  method SCIPcreateConsLinear(); all flags can be set via SCIPsetConsFLAGNAME-methods in scip.h
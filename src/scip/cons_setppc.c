@@ -2170,7 +2170,10 @@ SCIP_RETCODE processFixings(
 #ifndef NDEBUG
             fixedonefound = FALSE;
 #endif
-            for( v = 0; v < nvars && consdata->nfixedones == 1; ++v )
+            /* the fixings are counted immediately by the event handler, so stop as soon as all other variables are
+             * fixed to zero instead of scanning the remaining, already fixed variables
+             */
+            for( v = 0; v < nvars && consdata->nfixedones == 1 && consdata->nfixedzeros < nvars - 1; ++v )
             {
                var = vars[v];
                assert(SCIPisFeasZero(scip, SCIPvarGetUbLocal(var)) || SCIPisFeasEQ(scip, SCIPvarGetUbLocal(var), 1.0));
@@ -2192,8 +2195,11 @@ SCIP_RETCODE processFixings(
                   oneidx = v;
                }
             }
-            /* the fixed to one variable must have been found, and at least one variable must have been fixed */
-            assert(consdata->nfixedones >= 2 || (fixedonefound && *nfixedvars > oldnfixedvars));
+            /* at least one variable must have been fixed, and the fixed to one variable must have been found unless the
+             * loop stopped early because all other variables were fixed
+             */
+            assert(consdata->nfixedones >= 2 || ((fixedonefound || consdata->nfixedzeros == nvars - 1)
+                  && *nfixedvars > oldnfixedvars));
 
             SCIP_CALL( SCIPresetConsAge(scip, cons) );
          }
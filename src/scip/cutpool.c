@@ -507,32 +507,25 @@ SCIP_RETCODE SCIPcutpoolClear(
    return SCIP_OKAY;
 }
 
-/** removes the cut from the cut pool */
+/** frees the cut and removes it from the hash table of the cut pool, but does not update the array of cuts */
 static
-SCIP_RETCODE cutpoolDelCut(
+SCIP_RETCODE cutpoolFreeCut(
    SCIP_CUTPOOL*         cutpool,            /**< cut pool */
    BMS_BLKMEM*           blkmem,             /**< block memory */
    SCIP_SET*             set,                /**< global SCIP settings */
-   SCIP_STAT*            stat,               /**< problem statistics data */
    SCIP_LP*              lp,                 /**< current LP data */
-   SCIP_CUT*             cut                 /**< cut to remove */
+   int                   pos                 /**< position of cut to free */
    )
 {
-   int pos;
+   SCIP_CUT* cut;
 
    assert(cutpool != NULL);
-   assert(cutpool->firstunprocessed <= cutpool->ncuts);
-   assert(cutpool->firstunprocessedsol <= cutpool->ncuts);
-   assert(blkmem != NULL);
-   assert(stat != NULL);
-   assert(cutpool->processedlp <= stat->lpcount);
-   assert(cutpool->processedlpsol <= stat->lpcount);
+   assert(0 <= pos && pos < cutpool->ncuts);
+
+   cut = cutpool->cuts[pos];
    assert(cut != NULL);
    assert(cut->row != NULL);
-
-   pos = cut->pos;
-   assert(0 <= pos && pos < cutpool->ncuts);
-   assert(cutpool->cuts[pos] == cut);
+   assert(cut->pos == pos);
 
    /* decrease the number of removable cuts counter (row might have changed its removable status -> counting might not
     * be correct
@@ -558,6 +551,38 @@ SCIP_RETCODE cutpoolDelCut(
    /* free the cut */
    SCIP_CALL( cutFree(&cutpool->cuts[pos], blkmem, set, lp) );
 
+   return SCIP_OKAY;
+}
+
+/** removes the cut from the cut pool */
+static
+SCIP_RETCODE cutpoolDelCut(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_CUT*             cut                 /**< cut to remove */
+   )
+{
+   int pos;
+
+   assert(cutpool != NULL);
+   assert(cutpool->firstunprocessed <= cutpool->ncuts);
+   assert(cutpool->firstunprocessedsol <= cutpool->ncuts);
+   assert(blkmem != NULL);
+   assert(stat != NULL);
+   assert(cutpool->processedlp <= stat->lpcount);
+   assert(cutpool->processedlpsol <= stat->lpcount);
+   assert(cut != NULL);
+   assert(cut->row != NULL);
+
+   pos = cut->pos;
+   assert(0 <= pos && pos < cutpool->ncuts);
+   assert(cutpool->cuts[pos] == cut);
+
+   SCIP_CALL( cutpoolFreeCut(cutpool, blkmem, set, lp, pos) );
+
    --cutpool->ncuts;
    cutpool->firstunprocessed = MIN(cutpool->firstunprocessed, cutpool->ncuts);
    cutpool->firstunprocessedsol = MIN(cutpool->firstunprocessedsol, cutpool->ncuts);
@@ -578,6 +603,70 @@ SCIP_RETCODE cutpoolDelCut(
    return SCIP_OKAY;
 }
 
+/** removes the cuts at the given positions from the cut pool and moves the remaining cuts to the front, keeping their
+ *  order; this is used to delete all aged cuts found during a separation round at once
+ */
+static
+SCIP_RETCODE cutpoolDelCuts(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   int*                  delpos,             /**< positions of cuts to remove, sorted increasingly */
+   int                   ndelpos             /**< number of cuts to remove */
+   )
+{
+   int nshiftedunproc;
+   int nshiftedunprocsol;
+   int nkept;
+   int d;
+   int c;
+
+   assert(cutpool != NULL);
+   assert(delpos != NULL || ndelpos == 0);
+
+   if( ndelpos == 0 )
+      return SCIP_OKAY;
+
+   /* the first unprocessed cuts move to the front by the number of removed cuts before them */
+   nshiftedunproc = 0;
+   nshiftedunprocsol = 0;
+
+   nkept = delpos[0];
+   d = 0;
+   for( c = delpos[0]; c < cutpool->ncuts; ++c )
+   {
+      if( d < ndelpos && delpos[d] == c )
+      {
+         assert(d == 0 || delpos[d-1] < c);
+
+         if( c < cutpool->firstunprocessed )
+            ++nshiftedunproc;
+         if( c < cutpool->firstunprocessedsol )
+            ++nshiftedunprocsol;
+
+         SCIP_CALL( cutpoolFreeCut(cutpool, blkmem, set, lp, c) );
+         ++d;
+      }
+      else
+      {
+         cutpool->cuts[nkept] = cutpool->cuts[c];
+         cutpool->cuts[nkept]->pos = nkept;
+         ++nkept;
+      }
+   }
+   assert(d == ndelpos);
+   assert(nkept == cutpool->ncuts - ndelpos);
+
+   cutpool->ncuts = nkept;
+   cutpool->firstunprocessed -= nshiftedunproc;
+   cutpool->firstunprocessedsol -= nshiftedunprocsol;
+   cutpool->firstunprocessed = MIN(cutpool->firstunprocessed, cutpool->ncuts);
+   cutpool->firstunprocessedsol = MIN(cutpool->firstunprocessedsol, cutpool->ncuts);
+
+   return SCIP_OKAY;
+}
+
 /** checks if cut is already existing */
 SCIP_Bool SCIPcutpoolIsCutNew(
    SCIP_CUTPOOL*         cutpool,            /**< cut pool */
@@ -830,9 +919,11 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    SCIP_Bool cutoff;
    SCIP_Real minefficacy;
    SCIP_Bool retest;
+   int* delpos;
    int firstunproc;
    int oldncuts;
    int nefficaciouscuts;
+   int ndelpos;
    int c;
 
    assert(cutpool != NULL);
@@ -894,6 +985,10 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    oldncuts = SCIPsepastoreGetNCuts(sepastore);
    nefficaciouscuts = 0;
 
+   /* the cuts to remove are collected and deleted after the loop, such that the order of the cuts is kept */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &delpos, cutpool->ncuts - firstunproc) );
+   ndelpos = 0;
+
    /* process all unprocessed cuts in the pool */
    cutoff = FALSE;
    for( c = firstunproc; c < cutpool->ncuts; ++c )
@@ -929,7 +1024,7 @@ SCIP_RETCODE SCIPcutpoolSeparate(
             {
                /* insert bound change cut into separation store which will force that cut */
                SCIP_CALL( SCIPsepastoreAddCut(sepastore, blkmem, set, stat, eventqueue, eventfilter, lp, row, FALSE, root, &cutoff) );
-               SCIP_CALL( cutpoolDelCut(cutpool, blkmem, set, stat, lp, cut) );
+               delpos[ndelpos++] = c;
 
                if ( cutoff )
                   break;
@@ -978,14 +1073,16 @@ SCIP_RETCODE SCIPcutpoolSeparate(
             {
                cut->age++;
                if( cutIsAged(cut, cutpool->agelimit) )
-               {
-                  SCIP_CALL( cutpoolDelCut(cutpool, blkmem, set, stat, lp, cut) );
-               }
+                  delpos[ndelpos++] = c;
             }
          }
       }
    }
 
+   /* remove the aged cuts and the bound change cuts from the pool */
+   SCIP_CALL( cutpoolDelCuts(cutpool, blkmem, set, lp, delpos, ndelpos) );
+   SCIPsetFreeBufferArray(set, &delpos);
+
    if ( sol == NULL )
    {
       cutpool->processedlp = stat->lpcount;
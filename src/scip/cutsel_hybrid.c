@@ -25,9 +25,13 @@
 
 #include <assert.h>
 
+#include "scip/pub_lp.h"
+#include "scip/pub_var.h"
 #include "scip/scip_cutsel.h"
 #include "scip/scip_cut.h"
 #include "scip/scip_lp.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_prob.h"
 #include "scip/scip_randnumgen.h"
 #include "scip/cutsel_hybrid.h"
 
@@ -220,30 +224,77 @@ void selectBestCut(
 }
 
 /** filters the given array of cuts to enforce a maximum parallelism constraint
- *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
+ *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts
+ *
+ *  The coefficients of the given cut are scattered into the dense array, such that the scalar product with each other
+ *  cut only needs to run over the nonzeros of the other cut instead of merging both rows; as for the row norms, only
+ *  columns in the LP are taken into account.
+ */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   SCIP_Real*            densecut,           /**< clean array indexed by problem variable index to scatter the cut into */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             goodscore,          /**< threshold for the score to be considered a good cut */
    SCIP_Real             goodmaxparall,      /**< maximal parallelism for good cuts */
    SCIP_Real             maxparall           /**< maximal parallelism for all cuts that are not good */
    )
 {
+   SCIP_COL** cutcols;
+   SCIP_Real* cutvals;
+   SCIP_Real cutnorm;
+   int cutlen;
    int i;
+   int j;
 
    assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( densecut != NULL );
+
+   cutcols = SCIProwGetCols(cut);
+   cutvals = SCIProwGetVals(cut);
+   cutlen = SCIProwGetNNonz(cut);
+   cutnorm = SCIProwGetNorm(cut);
+
+   /* scatter the LP columns of the cut */
+   for( j = 0; j < cutlen; ++j )
+   {
+      assert(SCIPvarGetProbindex(SCIPcolGetVar(cutcols[j])) >= 0);
+      if( SCIPcolIsInLP(cutcols[j]) )
+         densecut[SCIPvarGetProbindex(SCIPcolGetVar(cutcols[j]))] = cutvals[j];
+   }
 
    for( i = ncuts - 1; i >= 0; --i )
    {
+      SCIP_COL** cols;
+      SCIP_Real* vals;
+      SCIP_Real scalarprod;
       SCIP_Real thisparall;
       SCIP_Real thismaxparall;
+      int len;
+
+      cols = SCIProwGetCols(cuts[i]);
+      vals = SCIProwGetVals(cuts[i]);
+      len = SCIProwGetNNonz(cuts[i]);
+
+      scalarprod = 0.0;
+      for( j = 0; j < len; ++j )
+         scalarprod += vals[j] * densecut[SCIPvarGetProbindex(SCIPcolGetVar(cols[j]))];
+
+      if( scalarprod == 0.0 )
+         thisparall = 0.0;
+      else if( cutnorm == 0.0 || SCIProwGetNorm(cuts[i]) == 0.0 )
+      {
+         /* norms that are wrongly zero are repaired by SCIProwGetParallelism() */
+         thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
+         cutnorm = SCIProwGetNorm(cut);
+      }
+      else
+         thisparall = REALABS(scalarprod) / (cutnorm * SCIProwGetNorm(cuts[i]));
 
-      thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
       thismaxparall = scores[i] >= goodscore ? goodmaxparall : maxparall;
 
       if( thisparall > thismaxparall )
@@ -254,6 +305,10 @@ int filterWithParallelism(
       }
    }
 
+   /* clean the dense array */
+   for( j = 0; j < cutlen; ++j )
+      densecut[SCIPvarGetProbindex(SCIPcolGetVar(cutcols[j]))] = 0.0;
+
    return ncuts;
 }
 
@@ -453,6 +508,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
 {
    SCIP_Real* scores;
    SCIP_Real* scoresptr;
+   SCIP_Real* densecut;
    SCIP_Real maxforcedscores;
    SCIP_Real maxnonforcedscores;
    SCIP_Real goodscore;
@@ -466,6 +522,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    *nselectedcuts = 0;
 
    SCIP_CALL( SCIPallocBufferArray(scip, &scores, ncuts) );
+   SCIP_CALL( SCIPallocCleanBufferArray(scip, &densecut, SCIPgetNVars(scip)) );
 
    /* compute scores of cuts and max score of cuts and forced cuts (used to define goodscore) */
    maxforcedscores = scoring(scip, forcedcuts, randnumgen, dircutoffdistweight, efficacyweight, objparalweight, intsupportweight, nforcedcuts, NULL);
@@ -482,7 +539,7 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    /* forced cuts are going to be selected so use them to filter cuts */
    for( i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
-      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, densecut, ncuts, goodscore, goodmaxparall, maxparall);
    }
 
    /* now greedily select the remaining cuts */
@@ -509,10 +566,11 @@ SCIP_RETCODE SCIPselectCutsHybrid(
       ++scores;
       --ncuts;
 
-      ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      ncuts = filterWithParallelism(selectedcut, cuts, scores, densecut, ncuts, goodscore, goodmaxparall, maxparall);
    }
 
 TERMINATE:
+   SCIPfreeCleanBufferArray(scip, &densecut);
    SCIPfreeBufferArray(scip, &scoresptr);
 
    return SCIP_OKAY;
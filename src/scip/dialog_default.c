@@ -1853,6 +1853,26 @@ SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayStatistics)
    return SCIP_OKAY;
 }
 
+/** dialog execution method for the display jsonstatistics command */
+SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayJsonStatistics)
+{  /*lint --e{715}*/
+   SCIP_CALL( SCIPdialoghdlrAddHistory(dialoghdlr, dialog, NULL, FALSE) );
+
+   SCIPdialogMessage(scip, NULL, "\n");
+   if( SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING || SCIPgetStage(scip) == SCIP_STAGE_PRESOLVED
+      || SCIPgetStage(scip) == SCIP_STAGE_SOLVING || SCIPgetStage(scip) == SCIP_STAGE_SOLVED )
+   {
+      SCIP_CALL( SCIPprintStatisticsJson(scip, NULL) );
+   }
+   else
+      SCIPdialogMessage(scip, NULL, "no statistics available: problem has not been presolved yet\n");
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   *nextdialog = SCIPdialoghdlrGetRoot(dialoghdlr);
+
+   return SCIP_OKAY;
+}
+
 /** dialog execution method for the display reoptstatistics command */
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayReoptStatistics)
 {  /*lint --e{715}*/
@@ -3873,6 +3893,56 @@ SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteStatistics)
    return SCIP_OKAY;
 }
 
+/** dialog execution method for the write jsonstatistics command */
+static
+SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteJsonStatistics)
+{  /*lint --e{715}*/
+   char* filename;
+   SCIP_Bool endoffile;
+
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   SCIP_CALL( SCIPdialoghdlrGetWord(dialoghdlr, dialog, "enter filename: ", &filename, &endoffile) );
+   if( endoffile )
+   {
+      *nextdialog = NULL;
+      return SCIP_OKAY;
+   }
+   if( filename[0] != '\0' )
+   {
+      FILE* file;
+
+      SCIP_CALL( SCIPdialoghdlrAddHistory(dialoghdlr, dialog, filename, TRUE) );
+
+      file = fopen(filename, "w");
+      if( file == NULL )
+      {
+         SCIPdialogMessage(scip, NULL, "error creating file <%s>\n", filename);
+         SCIPprintSysError(filename);
+         SCIPdialoghdlrClearBuffer(dialoghdlr);
+      }
+      else
+      {
+         if( SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING || SCIPgetStage(scip) == SCIP_STAGE_PRESOLVED
+            || SCIPgetStage(scip) == SCIP_STAGE_SOLVING || SCIPgetStage(scip) == SCIP_STAGE_SOLVED )
+         {
+            SCIP_CALL_FINALLY( SCIPprintStatisticsJson(scip, file), fclose(file) );
+
+            SCIPdialogMessage(scip, NULL, "written statistics in JSON format to file <%s>\n", filename);
+         }
+         else
+            SCIPdialogMessage(scip, NULL, "no statistics available: problem has not been presolved yet\n");
+         fclose(file);
+      }
+   } /*lint !e593*/
+
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   *nextdialog = SCIPdialoghdlrGetRoot(dialoghdlr);
+
+   return SCIP_OKAY;
+}
+
 /** dialog execution method for the write transproblem command */
 static
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteTransproblem)
@@ -4408,6 +4478,17 @@ SCIP_RETCODE SCIPincludeDialogDefaultBasic(
       SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
    }
 
+   /* display statistics in JSON format */
+   if( !SCIPdialogHasEntry(submenu, "jsonstatistics") )
+   {
+      SCIP_CALL( SCIPincludeDialog(scip, &dialog,
+            NULL,
+            SCIPdialogExecDisplayJsonStatistics, NULL, NULL,
+            "jsonstatistics", "display main and plugin statistics in JSON format", FALSE, NULL) );
+      SCIP_CALL( SCIPaddDialogEntry(scip, submenu, dialog) );
+      SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
+   }
+
    /* display reoptimization statistics */
    if( !SCIPdialogHasEntry(submenu, "reoptstatistics") )
    {
@@ -4705,6 +4786,17 @@ SCIP_RETCODE SCIPincludeDialogDefaultBasic(
       SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
    }
 
+   /* write statistics in JSON format */
+   if( !SCIPdialogHasEntry(submenu, "jsonstatistics") )
+   {
+      SCIP_CALL( SCIPincludeDialog(scip, &dialog,
+            NULL,
+            SCIPdialogExecWriteJsonStatistics, NULL, NULL,
+            "jsonstatistics", "write main and plugin statistics in JSON format to file", FALSE, NULL) );
+      SCIP_CALL( SCIPaddDialogEntry(scip, submenu, dialog) );
+      SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
+   }
+
    /* write transproblem */
    if( !SCIPdialogHasEntry(submenu, "transproblem") )
    {
@@ -179,6 +179,10 @@ SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplaySubSolution);
 SCIP_EXPORT
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayStatistics);
 
+/** dialog execution method for the display jsonstatistics command */
+SCIP_EXPORT
+SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayJsonStatistics);
+
 /** dialog execution method for the display reoptstatistics command */
 SCIP_EXPORT
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayReoptStatistics);
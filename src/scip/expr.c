@@ -2651,6 +2651,15 @@ SCIP_RETCODE SCIPexprEval(
    expr->evalvalue = SCIP_INVALID;
    expr->evaltag = soltag;
 
+   /* leaves (variables and values) can be evaluated directly, without setting up an expression iterator */
+   if( expr->nchildren == 0 )
+   {
+      SCIP_CALL( SCIPexprhdlrEvalExpr(expr->exprhdlr, set, NULL , expr, &expr->evalvalue, NULL, sol) );
+      expr->evaltag = soltag;
+
+      return SCIP_OKAY;
+   }
+
    SCIP_CALL( SCIPexpriterCreate(stat, blkmem, &it) );
    SCIP_CALL( SCIPexpriterInit(it, expr, SCIP_EXPRITER_DFS, TRUE) );
    SCIPexpriterSetStagesDFS(it, SCIP_EXPRITER_VISITINGCHILD | SCIP_EXPRITER_LEAVEEXPR);
@@ -2663,12 +2672,10 @@ SCIP_RETCODE SCIPexprEval(
          {
             SCIP_EXPR* child;
 
-            if( soltag == 0 )
-               break;
+            child = SCIPexpriterGetChildExprDFS(it);
 
             /* check whether child has been evaluated for that solution already */
-            child = SCIPexpriterGetChildExprDFS(it);
-            if( soltag == child->evaltag )
+            if( soltag != 0 && soltag == child->evaltag )
             {
                if( child->evalvalue == SCIP_INVALID )
                   goto TERMINATE;
@@ -2680,6 +2687,19 @@ SCIP_RETCODE SCIPexprEval(
                continue;
             }
 
+            /* evaluate a leaf child directly instead of descending into it with the iterator */
+            if( child->nchildren == 0 )
+            {
+               SCIP_CALL( SCIPexprhdlrEvalExpr(child->exprhdlr, set, NULL , child, &child->evalvalue, NULL, sol) );
+               child->evaltag = soltag;
+
+               if( child->evalvalue == SCIP_INVALID )
+                  goto TERMINATE;
+
+               expr = SCIPexpriterSkipDFS(it);
+               continue;
+            }
+
             break;
          }
 
@@ -34,14 +34,41 @@
 /* file i/o using zlib */
 #include <zlib.h>
 
+/* size of the internal buffer of zlib; the default of 8 KB leads to many small reads for large problem files */
+#define GZBUFFER_LEN 262144
+
+/** enlarges the internal buffer of a freshly opened zlib file */
+static
+void setGzBuffer(
+   gzFile                file                /**< zlib file, or NULL */
+   )
+{
+#if ZLIB_VERNUM >= 0x1240
+   if( file != NULL )
+      (void) gzbuffer(file, GZBUFFER_LEN);
+#else
+   (void) file;
+#endif
+}
+
 SCIP_FILE* SCIPfopen(const char *path, const char *mode)
 {
-   return (SCIP_FILE*)gzopen(path, mode);
+   gzFile file;
+
+   file = gzopen(path, mode);
+   setGzBuffer(file);
+
+   return (SCIP_FILE*)file;
 }
 
 SCIP_FILE* SCIPfdopen(int fildes, const char *mode)
 {
-   return (SCIP_FILE*)gzdopen(fildes, mode);
+   gzFile file;
+
+   file = gzdopen(fildes, mode);
+   setGzBuffer(file);
+
+   return (SCIP_FILE*)file;
 }
 
 size_t SCIPfread(void *ptr, size_t size, size_t nmemb, SCIP_FILE *stream)
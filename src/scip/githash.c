@@ -0,0 +1 @@
+#define SCIP_GITHASH "f663466"
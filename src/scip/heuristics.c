@@ -861,6 +861,7 @@ SCIP_RETCODE createRows(
    SCIP_ROW** rows;                          /* original scip rows                       */
    SCIP_CONS* cons;                          /* new constraint                           */
    SCIP_VAR** consvars;                      /* new constraint's variables               */
+   SCIP_Real* consvals;                      /* new constraint's coefficient values      */
    SCIP_COL** cols;                          /* original row's columns                   */
 
    SCIP_Real constant;                       /* constant added to the row                */
@@ -870,6 +871,7 @@ SCIP_RETCODE createRows(
 
    int nrows;
    int nnonz;
+   int nconsvars;
    int i;
    int j;
 
@@ -893,18 +895,53 @@ SCIP_RETCODE createRows(
 
       assert(lhs <= rhs);
 
-      /* allocate memory array to be filled with the corresponding subproblem variables */
+      /* allocate memory arrays to be filled with the corresponding subproblem variables and their coefficients */
       SCIP_CALL( SCIPallocBufferArray(scip, &consvars, nnonz) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &consvals, nnonz) );
+
+      /* variables that are fixed in the subproblem, e.g., by the fixings of the heuristic, are moved into the sides,
+       * such that the size of the subproblem is proportional to the number of unfixed variables
+       */
+      nconsvars = 0;
       for( j = 0; j < nnonz; j++ )
-         consvars[j] = (SCIP_VAR*) SCIPhashmapGetImage(varmap, (SCIPcolGetVar(cols[j])));
+      {
+         SCIP_VAR* subvar;
+
+         subvar = (SCIP_VAR*) SCIPhashmapGetImage(varmap, (SCIPcolGetVar(cols[j])));
+         assert(subvar != NULL);
 
-      /* create a new linear constraint and add it to the subproblem */
-      SCIP_CALL( SCIPcreateConsLinear(subscip, &cons, SCIProwGetName(rows[i]), nnonz, consvars, vals, lhs, rhs,
-            TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, TRUE, FALSE) );
-      SCIP_CALL( SCIPaddCons(subscip, cons) );
-      SCIP_CALL( SCIPreleaseCons(subscip, &cons) );
+         if( SCIPisEQ(subscip, SCIPvarGetLbGlobal(subvar), SCIPvarGetUbGlobal(subvar)) )
+         {
+            SCIP_Real activity;
+
+            activity = vals[j] * SCIPvarGetLbGlobal(subvar);
+
+            if( !SCIPisInfinity(scip, -lhs) )
+               lhs -= activity;
+            if( !SCIPisInfinity(scip, rhs) )
+               rhs -= activity;
+         }
+         else
+         {
+            consvars[nconsvars] = subvar;
+            consvals[nconsvars] = vals[j];
+            ++nconsvars;
+         }
+      }
+
+      /* create a new linear constraint and add it to the subproblem, unless all variables are fixed and the row is
+       * satisfied
+       */
+      if( nconsvars > 0 || SCIPisFeasPositive(scip, lhs) || SCIPisFeasNegative(scip, rhs) )
+      {
+         SCIP_CALL( SCIPcreateConsLinear(subscip, &cons, SCIProwGetName(rows[i]), nconsvars, consvars, consvals, lhs, rhs,
+               TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, TRUE, FALSE) );
+         SCIP_CALL( SCIPaddCons(subscip, cons) );
+         SCIP_CALL( SCIPreleaseCons(subscip, &cons) );
+      }
 
       /* free temporary memory */
+      SCIPfreeBufferArray(scip, &consvals);
       SCIPfreeBufferArray(scip, &consvars);
    }
 
@@ -35,6 +35,7 @@
 #include "scip/struct_stat.h"
 #include "scip/var.h"
 
+#define CLIQUELIST_BISECTFACTOR 8       /**< minimal ratio of the clique list lengths to search a common clique by bisection */
 
 
 /*
@@ -1636,6 +1637,42 @@ SCIP_Bool SCIPcliquelistsHaveCommonClique(
          ncliques2 = tmpi;
       }
 
+      /* if the second list is much shorter, search each of its cliques in the first list by bisection instead of
+       * merging both lists
+       */
+      if( ncliques1 >= CLIQUELIST_BISECTFACTOR * ncliques2 )
+      {
+         for( i2 = 0; i2 < ncliques2; ++i2 )
+         {
+            int hi;
+
+            cliqueid = SCIPcliqueGetId(cliques2[i2]);
+            hi = ncliques1 - 1;
+
+            /* all remaining cliques of the second list have larger indices than all cliques of the first list */
+            if( SCIPcliqueGetId(cliques1[hi]) < cliqueid )
+               return FALSE;
+
+            /* find the first position in the first list with an index not smaller than cliqueid */
+            while( i1 < hi )
+            {
+               int mid;
+
+               mid = i1 + (hi - i1) / 2;
+               if( SCIPcliqueGetId(cliques1[mid]) < cliqueid )
+                  i1 = mid + 1;
+               else
+                  hi = mid;
+            }
+            assert(SCIPcliqueGetId(cliques1[i1]) >= cliqueid);
+
+            if( SCIPcliqueGetId(cliques1[i1]) == cliqueid )
+               return TRUE;
+         }
+
+         return FALSE;
+      }
+
       /* check whether both clique lists have a same clique */
       while( TRUE )  /*lint !e716*/
       {
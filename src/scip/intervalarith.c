@@ -688,17 +688,26 @@ void SCIPintervalAdd(
    assert(!SCIPintervalIsEmpty(infinity, operand1));
    assert(!SCIPintervalIsEmpty(infinity, operand2));
 
+   /* both bounds are computed with upwards rounding, so that the rounding mode needs to be switched at most once;
+    * the infimum is computed as -((-a) - b), which equals a + b rounded downwards
+    */
    roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
 
    /* compute infimum of result */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   SCIPintervalAddInf(infinity, resultant, operand1, operand2);
+   if( operand1.inf <= -infinity || operand2.inf <= -infinity )
+      resultant->inf = -infinity;
+   else if( operand1.inf >= infinity || operand2.inf >= infinity )
+      resultant->inf = infinity;
+   else
+      resultant->inf = negate(negate(operand1.inf) - operand2.inf);
 
    /* compute supremum of result */
-   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    SCIPintervalAddSup(infinity, resultant, operand1, operand2);
 
-   intervalSetRoundingMode(roundmode);
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(roundmode);
 }
 
 /** adds operand1 and scalar operand2 and stores result in resultant */
@@ -714,7 +723,10 @@ void SCIPintervalAddScalar(
    assert(resultant != NULL);
    assert(!SCIPintervalIsEmpty(infinity, operand1));
 
+   /* both bounds are computed with upwards rounding; the infimum is computed as -((-a) - b) */
    roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
 
    /* -inf + something >= -inf */
    if( operand1.inf <= -infinity || operand2 <= -infinity )
@@ -728,8 +740,7 @@ void SCIPintervalAddScalar(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-      resultant->inf = operand1.inf + operand2;
+      resultant->inf = negate(negate(operand1.inf) - operand2);
    }
 
    /* inf + something <= inf */
@@ -744,11 +755,11 @@ void SCIPintervalAddScalar(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
       resultant->sup = operand1.sup + operand2;
    }
 
-   intervalSetRoundingMode(roundmode);
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(roundmode);
 }
 
 /** adds vector operand1 and vector operand2 and stores result in vector resultant */
@@ -795,7 +806,12 @@ void SCIPintervalSub(
    assert(!SCIPintervalIsEmpty(infinity, operand1));
    assert(!SCIPintervalIsEmpty(infinity, operand2));
 
+   /* both bounds are computed with upwards rounding, so that the rounding mode needs to be switched at most once;
+    * the infimum is computed as -(b - a), which equals a - b rounded downwards
+    */
    roundmode = intervalGetRoundingMode();
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
 
    if( operand1.inf <= -infinity || operand2.sup >=  infinity )
       resultant->inf = -infinity;
@@ -804,12 +820,14 @@ void SCIPintervalSub(
    {
       resultant->inf = infinity;
       resultant->sup = infinity;
+
+      if( roundmode != SCIP_ROUND_UPWARDS )
+         intervalSetRoundingMode(roundmode);
       return;
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-      resultant->inf = operand1.inf - operand2.sup;
+      resultant->inf = negate(operand2.sup - operand1.inf);
    }
 
    if( operand1.sup >=  infinity || operand2.inf <= -infinity )
@@ -822,11 +840,11 @@ void SCIPintervalSub(
    }
    else
    {
-      intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
       resultant->sup = operand1.sup - operand2.inf;
    }
 
-   intervalSetRoundingMode(roundmode);
+   if( roundmode != SCIP_ROUND_UPWARDS )
+      intervalSetRoundingMode(roundmode);
 }
 
 /** subtracts scalar operand2 from operand1 and stores result in resultant */
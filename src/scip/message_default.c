@@ -29,16 +29,23 @@
  * Local methods
  */
 
-/** prints a message to the given file stream and writes the same messate to the log file */
+/** prints a message to the given file stream and writes the same message to the log file
+ *
+ *  Only the standard streams and the log file are flushed after each message, such that the output appears
+ *  immediately. Other files, e.g., solution or problem files, are written through the buffer of the stream, which is
+ *  flushed when the file is closed.
+ */
 static
 void logMessage(
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
    FILE*                 file,               /**< file stream to print message into */
    const char*           msg                 /**< message to print (or NULL to flush) */
    )
 {
    if ( msg != NULL )
       fputs(msg, file);
-   fflush(file);
+   if ( msg == NULL || file == stdout || file == stderr || file == SCIPmessagehdlrGetLogfile(messagehdlr) )
+      fflush(file);
 }
 
 /*
@@ -52,21 +59,21 @@ SCIP_DECL_MESSAGEWARNING(messageWarningDefault)
    if ( msg != NULL && msg[0] != '\0' && msg[0] != '\n' )
       fputs("WARNING: ", file);
 
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** dialog message print method of message handler */
 static
 SCIP_DECL_MESSAGEDIALOG(messageDialogDefault)
 {  /*lint --e{715}*/
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** info message print method of message handler */
 static
 SCIP_DECL_MESSAGEINFO(messageInfoDefault)
 {  /*lint --e{715}*/
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** Create default message handler. To free the message handler use SCIPmessagehdlrRelease(). */
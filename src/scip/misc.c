@@ -2575,6 +2575,11 @@ void* SCIPhashtableRetrieve(
    {
       uint32_t distance;
 
+      /* found element; the key is only compared if the hash values match */
+      if( hashtable->hashes[pos] == hashval && hashtable->hashkeyeq(hashtable->userptr,
+             hashtable->hashgetkey(hashtable->userptr, hashtable->slots[pos]), key) )
+         return hashtable->slots[pos];
+
       /* slots is empty so element cannot be contained */
       if( hashtable->hashes[pos] == 0 )
          return NULL;
@@ -2585,11 +2590,6 @@ void* SCIPhashtableRetrieve(
       if( elemdistance > distance )
          return NULL;
 
-      /* found element */
-      if( hashtable->hashes[pos] == hashval && hashtable->hashkeyeq(hashtable->userptr,
-             hashtable->hashgetkey(hashtable->userptr, hashtable->slots[pos]), key) )
-         return hashtable->slots[pos];
-
       pos = (pos + 1) & hashtable->mask;
       ++elemdistance;
    }
@@ -2940,6 +2940,10 @@ SCIP_Bool hashmapLookup(
    {
       uint32_t distance;
 
+      /* found element; the hash value is compared first such that the slot has only to be loaded on a match */
+      if( hashmap->hashes[*pos] == hashval && hashmap->slots[*pos].origin == origin )
+         return TRUE;
+
       /* slots is empty so element cannot be contained */
       if( hashmap->hashes[*pos] == 0 )
          return FALSE;
@@ -2949,10 +2953,6 @@ SCIP_Bool hashmapLookup(
       if( elemdistance > distance )
          return FALSE;
 
-      /* found element */
-      if( hashmap->hashes[*pos] == hashval && hashmap->slots[*pos].origin == origin )
-         return TRUE;
-
       *pos = (*pos + 1) & hashmap->mask;
       ++elemdistance;
    }
@@ -5774,12 +5774,14 @@ void SCIPsort(
 /* SCIPsortInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     Int
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #include "scip/sorttpl.c" /*lint !e451*/
 
 
 /* SCIPsortIntInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     IntInt
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  int
 #include "scip/sorttpl.c" /*lint !e451*/
 
@@ -5787,6 +5789,7 @@ void SCIPsort(
 /* SCIPsortIntReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     IntReal
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #include "scip/sorttpl.c" /*lint !e451*/
 
@@ -5794,6 +5797,7 @@ void SCIPsort(
 /* SCIPsortIntPtr(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     IntPtr
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  void*
 #include "scip/sorttpl.c" /*lint !e451*/
 
@@ -5801,6 +5805,7 @@ void SCIPsort(
 /* SCIPsortIntIntInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     IntIntInt
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  int
 #include "scip/sorttpl.c" /*lint !e451*/
@@ -5832,6 +5837,7 @@ void SCIPsort(
 /* SCIPsortIntIntReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     IntIntReal
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #include "scip/sorttpl.c" /*lint !e451*/
@@ -5840,6 +5846,7 @@ void SCIPsort(
 /* SCIPsortIntPtrReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     IntPtrReal
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_FIELD2TYPE  SCIP_Real
 #include "scip/sorttpl.c" /*lint !e451*/
@@ -6339,6 +6346,7 @@ void SCIPsortDown(
 /* SCIPsortDownInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     DownInt
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_BACKWARDS
 #include "scip/sorttpl.c" /*lint !e451*/
 
@@ -6346,6 +6354,7 @@ void SCIPsortDown(
 /* SCIPsortDownIntInt(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     DownIntInt
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  int
 #define SORTTPL_BACKWARDS
 #include "scip/sorttpl.c" /*lint !e451*/
@@ -6363,6 +6372,7 @@ void SCIPsortDown(
 /* SCIPsortDownIntReal(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     DownIntReal
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  SCIP_Real
 #define SORTTPL_BACKWARDS
 #include "scip/sorttpl.c" /*lint !e451*/
@@ -6371,6 +6381,7 @@ void SCIPsortDown(
 /* SCIPsortDownIntPtr(), SCIPsortedvecInsert...(), SCIPsortedvecDelPos...(), SCIPsortedvecFind...() via sort template */
 #define SORTTPL_NAMEEXT     DownIntPtr
 #define SORTTPL_KEYTYPE     int
+#define SORTTPL_RADIXSORT
 #define SORTTPL_FIELD1TYPE  void*
 #define SORTTPL_BACKWARDS
 #include "scip/sorttpl.c" /*lint !e451*/
@@ -9919,6 +9930,9 @@ void SCIPrandomSetSeed(
    unsigned int          initseed            /**< initial random seed */
    )
 {
+   uint64_t z;
+   int i;
+
    assert(randnumgen != NULL);
 
    /* use MAX() to avoid zero after over flowing */
@@ -9927,11 +9941,73 @@ void SCIPrandomSetSeed(
    randnumgen->mwc_seed = MAX(SCIPhashTwo(DEFAULT_MWC, initseed), 1u);
    randnumgen->cst_seed = SCIPhashTwo(DEFAULT_CST, initseed);
 
+   /* the state of xoshiro256++ is initialized by splitmix64, which never returns four zeros in a row */
+   z = (uint64_t)initseed;
+   for( i = 0; i < 4; ++i )
+   {
+      z += UINT64_C(0x9e3779b97f4a7c15);
+      randnumgen->xoshiro[i] = z;
+      randnumgen->xoshiro[i] = (randnumgen->xoshiro[i] ^ (randnumgen->xoshiro[i] >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+      randnumgen->xoshiro[i] = (randnumgen->xoshiro[i] ^ (randnumgen->xoshiro[i] >> 27)) * UINT64_C(0x94d049bb133111eb);
+      randnumgen->xoshiro[i] ^= randnumgen->xoshiro[i] >> 31;
+   }
+
    assert(randnumgen->seed > 0);
    assert(randnumgen->xor_seed > 0);
    assert(randnumgen->mwc_seed > 0);
 }
 
+/** selects the xoshiro256++ generator instead of the default KISS generator */
+void SCIPrandomSetXoshiro(
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   SCIP_Bool             usexoshiro          /**< should xoshiro256++ be used? */
+   )
+{
+   assert(randnumgen != NULL);
+
+   randnumgen->usexoshiro = usexoshiro;
+}
+
+/** rotates a 64-bit integer to the left */
+static
+uint64_t rotl64(
+   uint64_t              x,                  /**< integer to rotate */
+   int                   k                   /**< number of bits to rotate by, between 1 and 63 */
+   )
+{
+   return (x << k) | (x >> (64 - k));
+}
+
+/** returns a random number between 0 and UINT32_MAX
+ *
+ *  implementation of xoshiro256++ by David Blackman and Sebastiano Vigna [1], which has a period of 2^256 - 1; the upper
+ *  32 bits of each 64-bit output are returned.
+ *
+ *  [1] https://prng.di.unimi.it/
+ */
+static
+uint32_t randomGetRandXoshiro(
+   SCIP_RANDNUMGEN*      randnumgen          /**< random number generator */
+   )
+{
+   uint64_t* s;
+   uint64_t result;
+   uint64_t t;
+
+   s = randnumgen->xoshiro;
+   result = rotl64(s[0] + s[3], 23) + s[0];
+   t = s[1] << 17;
+
+   s[2] ^= s[0];
+   s[3] ^= s[1];
+   s[1] ^= s[2];
+   s[0] ^= s[3];
+   s[2] ^= t;
+   s[3] = rotl64(s[3], 45);
+
+   return (uint32_t) (result >> 32);
+}
+
 /** returns a random number between 0 and UINT32_MAX
  *
  *  implementation of KISS random number generator developed by George Marsaglia.
@@ -9951,6 +10027,9 @@ uint32_t randomGetRand(
 {
    uint64_t t;
 
+   if( randnumgen->usexoshiro )
+      return randomGetRandXoshiro(randnumgen);
+
    /* linear congruential */
    randnumgen->seed = (uint32_t) (randnumgen->seed * UINT64_C(1103515245) + UINT64_C(12345));
 
@@ -9978,6 +10057,7 @@ SCIP_RETCODE SCIPrandomCreate(
 
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, randnumgen) );
 
+   (*randnumgen)->usexoshiro = FALSE;
    SCIPrandomSetSeed((*randnumgen), initialseed);
 
    return SCIP_OKAY;
@@ -10040,6 +10120,63 @@ SCIP_Real SCIPrandomGetReal(
    return minrandval*(1.0 - randnumber) + maxrandval*randnumber;
 }
 
+/** fills an array with random integers between minrandval and maxrandval */
+void SCIPrandomGetInts(
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   int                   minrandval,         /**< minimal value to return */
+   int                   maxrandval,         /**< maximal value to return */
+   int*                  vals,               /**< array to store the random integers */
+   int                   nvals               /**< number of random integers to draw */
+   )
+{
+   SCIP_Longint zeromax;
+   int i;
+
+   assert(randnumgen != NULL);
+   assert(vals != NULL || nvals == 0);
+
+   /* compute the range once; see SCIPrandomGetInt() */
+   zeromax = (SCIP_Longint)maxrandval - (SCIP_Longint)minrandval + 1;
+
+   for( i = 0; i < nvals; ++i )
+   {
+      SCIP_Real randnumber;
+
+      randnumber = (SCIP_Real)randomGetRand(randnumgen)/(UINT32_MAX+1.0);
+      assert(randnumber >= 0.0);
+      assert(randnumber < 1.0);
+
+      vals[i] = (int) ((SCIP_Longint)(zeromax * randnumber) + (SCIP_Longint)minrandval); /*lint !e613*/
+   }
+}
+
+/** fills an array with random reals between minrandval and maxrandval */
+void SCIPrandomGetReals(
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   SCIP_Real             minrandval,         /**< minimal value to return */
+   SCIP_Real             maxrandval,         /**< maximal value to return */
+   SCIP_Real*            vals,               /**< array to store the random reals */
+   int                   nvals               /**< number of random reals to draw */
+   )
+{
+   int i;
+
+   assert(randnumgen != NULL);
+   assert(vals != NULL || nvals == 0);
+
+   for( i = 0; i < nvals; ++i )
+   {
+      SCIP_Real randnumber;
+
+      randnumber = (SCIP_Real)randomGetRand(randnumgen)/(SCIP_Real)UINT32_MAX;
+      assert(randnumber >= 0.0);
+      assert(randnumber <= 1.0);
+
+      /* see SCIPrandomGetReal() */
+      vals[i] = minrandval*(1.0 - randnumber) + maxrandval*randnumber; /*lint !e613*/
+   }
+}
+
 /** randomly shuffles parts of an integer array using the Fisher-Yates algorithm */
 void SCIPrandomPermuteIntArray(
    SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
@@ -368,6 +368,17 @@ void SCIPrandomSetSeed(
    unsigned int          initseed            /**< initial random seed */
    );
 
+/** selects the xoshiro256++ generator instead of the default KISS generator
+ *
+ *  @note The generator keeps its seed; to obtain the same stream as a newly created generator, the seed needs to be
+ *        reset after selecting the generator.
+ */
+SCIP_EXPORT
+void SCIPrandomSetXoshiro(
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   SCIP_Bool             usexoshiro          /**< should xoshiro256++ be used? */
+   );
+
 #ifdef __cplusplus
 }
 #endif
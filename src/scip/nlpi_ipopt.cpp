@@ -1166,7 +1166,7 @@ SCIP_DECL_NLPICHGVARBOUNDS(nlpiChgVarBoundsIpopt)
          if( problem->solprimalvalid )
          {
             assert(problem->solprimals != NULL);
-            problem->solprimals[i] = MIN(MAX(problem->solprimals[indices[i]], lbs[i]), ubs[i]);
+            problem->solprimals[indices[i]] = MIN(MAX(problem->solprimals[indices[i]], lbs[i]), ubs[i]);
          }
       }
    }
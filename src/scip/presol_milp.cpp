@@ -455,37 +455,58 @@ SCIP_DECL_PRESOLEXEC(presolExecMILP)
          SCIP_CALL( SCIPdelCons(scip, SCIPmatrixGetCons(matrix, i)) );
       }
 
-      /* now loop over rows of presolved problem and create them as new linear constraints,
-       * then release the old constraint after its name was passed to the new constraint */
+      /* now collect the rows of presolved problem and create them as new linear constraints in one block,
+       * then release the old constraints after their names were passed to the new constraints */
       const Vec<RowFlags>& rflags = problem.getRowFlags();
       const auto& consmatrix = problem.getConstraintMatrix();
+      std::vector<SCIP_CONS*> newconss(newnrows);
+      std::vector<const char*> names(newnrows);
+      std::vector<int> beg(newnrows + 1);
+      std::vector<SCIP_Real> lhss(newnrows);
+      std::vector<SCIP_Real> rhss(newnrows);
+
+      tmpvars.clear();
+      tmpvals.clear();
+      tmpvars.reserve(newnnz);
+      tmpvals.reserve(newnnz);
       for( int i = 0; i < newnrows; ++i )
       {
          auto rowvec = consmatrix.getRowCoefficients(i);
          const int* rowcols = rowvec.getIndices();
-         /* SCIPcreateConsBasicLinear() requires a non const pointer */
-         SCIP_Real* rowvals = const_cast<SCIP_Real*>(rowvec.getValues());
+         const SCIP_Real* rowvals = rowvec.getValues();
          int rowlen = rowvec.getLength();
 
          /* retrieve SCIP compatible left and right hand sides */
-         SCIP_Real lhs = rflags[i].test(RowFlag::kLhsInf) ? - SCIPinfinity(scip) : consmatrix.getLeftHandSides()[i];
-         SCIP_Real rhs = rflags[i].test(RowFlag::kRhsInf) ? SCIPinfinity(scip) : consmatrix.getRightHandSides()[i];
+         lhss[i] = rflags[i].test(RowFlag::kLhsInf) ? - SCIPinfinity(scip) : consmatrix.getLeftHandSides()[i];
+         rhss[i] = rflags[i].test(RowFlag::kRhsInf) ? SCIPinfinity(scip) : consmatrix.getRightHandSides()[i];
 
-         /* create variable array matching the value array */
-         tmpvars.clear();
-         tmpvars.reserve(rowlen);
+         /* append the entries of the row with variables matching the values */
+         beg[i] = (int) tmpvars.size();
          for( int j = 0; j < rowlen; ++j )
+         {
             tmpvars.push_back(SCIPmatrixGetVar(matrix, res.postsolve.origcol_mapping[rowcols[j]]));
+            tmpvals.push_back(rowvals[j]);
+         }
 
-         /* create and add new constraint with name of old constraint */
+         /* the new constraint gets the name of old constraint */
+         names[i] = SCIPconsGetName(SCIPmatrixGetCons(matrix, res.postsolve.origrow_mapping[i]));
+      }
+      beg[newnrows] = (int) tmpvars.size();
+
+      if( newnrows > 0 )
+      {
+         SCIP_CALL( SCIPcreateConssLinear(scip, newconss.data(), newnrows, names.data(), beg.data(), tmpvars.data(),
+               tmpvals.data(), lhss.data(), rhss.data(), TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+      }
+
+      /* add new constraints and release old and new constraints */
+      for( int i = 0; i < newnrows; ++i )
+      {
          SCIP_CONS* oldcons = SCIPmatrixGetCons(matrix, res.postsolve.origrow_mapping[i]);
-         SCIP_CONS* cons;
-         SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, SCIPconsGetName(oldcons), rowlen, tmpvars.data(), rowvals, lhs, rhs) );
-         SCIP_CALL( SCIPaddCons(scip, cons) );
 
-         /* release old and new constraint */
+         SCIP_CALL( SCIPaddCons(scip, newconss[i]) );
+         SCIP_CALL( SCIPreleaseCons(scip, &newconss[i]) );
          SCIP_CALL( SCIPreleaseCons(scip, &oldcons) );
-         SCIP_CALL( SCIPreleaseCons(scip, &cons) );
       }
    }
 
@@ -192,6 +192,10 @@ struct SCIP_PropData
                                               *   vboundboundedidx */
    int*                  nvbounds;           /**< array storing for each bound index the number of vbounds stored */
    int*                  vboundsize;         /**< array with sizes of vbound arrays for the nodes */
+   int*                  vboundboundedidxdata;/**< contiguous storage of the vboundboundedidx arrays of all bounds */
+   SCIP_Real*            vboundcoefdata;     /**< contiguous storage of the vboundcoefs arrays of all bounds */
+   SCIP_Real*            vboundconstantdata; /**< contiguous storage of the vboundconstants arrays of all bounds */
+   int                   nvbounddata;        /**< total number of vbounds in the contiguous storage */
    int                   nbounds;            /**< number of bounds of variables regarded (two times number of active variables) */
    int                   lastpresolncliques; /**< number of cliques created until the last call to the presolver */
    SCIP_PQUEUE*          propqueue;          /**< priority queue to handle the bounds of variables that were changed and have to be propagated */
@@ -336,6 +340,10 @@ void resetPropdata(
    propdata->vboundconstants = NULL;
    propdata->nvbounds = NULL;
    propdata->vboundsize = NULL;
+   propdata->vboundboundedidxdata = NULL;
+   propdata->vboundcoefdata = NULL;
+   propdata->vboundconstantdata = NULL;
+   propdata->nvbounddata = 0;
    propdata->nbounds = 0;
    propdata->initialized = FALSE;
 }
@@ -494,6 +502,67 @@ SCIP_RETCODE addVbound(
    return SCIP_OKAY;
 }
 
+/** moves the vbounds of all bounds into contiguous arrays, such that the vbounds of consecutive bounds are stored
+ *  consecutively and the graph traversals during propagation access memory sequentially
+ */
+static
+SCIP_RETCODE compactVbounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   int nvbounddata;
+   int pos;
+   int v;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(propdata->vboundboundedidxdata == NULL);
+
+   nvbounddata = 0;
+   for( v = 0; v < propdata->nbounds; ++v )
+      nvbounddata += propdata->nvbounds[v];
+
+   if( nvbounddata == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundboundedidxdata, nvbounddata) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundcoefdata, nvbounddata) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundconstantdata, nvbounddata) );
+   propdata->nvbounddata = nvbounddata;
+
+   pos = 0;
+   for( v = 0; v < propdata->nbounds; ++v )
+   {
+      int nvbounds;
+
+      if( propdata->vboundsize[v] == 0 )
+         continue;
+
+      nvbounds = propdata->nvbounds[v];
+      assert(pos + nvbounds <= nvbounddata);
+
+      BMScopyMemoryArray(&propdata->vboundboundedidxdata[pos], propdata->vboundboundedidx[v], nvbounds);
+      BMScopyMemoryArray(&propdata->vboundcoefdata[pos], propdata->vboundcoefs[v], nvbounds);
+      BMScopyMemoryArray(&propdata->vboundconstantdata[pos], propdata->vboundconstants[v], nvbounds);
+
+      SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx[v]);
+      SCIPfreeMemoryArray(scip, &propdata->vboundcoefs[v]);
+      SCIPfreeMemoryArray(scip, &propdata->vboundconstants[v]);
+
+      /* let the arrays of the bound point into the contiguous storage */
+      propdata->vboundboundedidx[v] = &propdata->vboundboundedidxdata[pos];
+      propdata->vboundcoefs[v] = &propdata->vboundcoefdata[pos];
+      propdata->vboundconstants[v] = &propdata->vboundconstantdata[pos];
+      propdata->vboundsize[v] = nvbounds;
+
+      pos += nvbounds;
+   }
+   assert(pos == nvbounddata);
+
+   return SCIP_OKAY;
+}
+
 /** comparison method for two indices in the topoorder array, preferring higher indices because the order is reverse
  *  topological
  */
@@ -1322,6 +1391,9 @@ SCIP_RETCODE initData(
       }
    }
 
+   /* store the collected vbounds contiguously */
+   SCIP_CALL( compactVbounds(scip, propdata) );
+
    /* sort the bounds topologically */
    if( propdata->dotoposort )
    {
@@ -2156,7 +2228,6 @@ static
 SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
 {  /*lint --e{715}*/
    SCIP_PROPDATA* propdata;
-   int v;
 
    propdata = SCIPpropGetData(prop);
    assert(propdata != NULL);
@@ -2167,17 +2238,10 @@ SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
       /* drop all variable events */
       SCIP_CALL( dropEvents(scip, propdata) );
 
-      /* release all variables */
-      for( v = 0; v < propdata->nbounds; ++v )
-      {
-         /* free vbound data */
-         if( propdata->vboundsize[v] > 0 )
-         {
-            SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundcoefs[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundconstants[v]);
-         }
-      }
+      /* free vbound data; the arrays of the single bounds point into the contiguous storage */
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundconstantdata, propdata->nvbounddata);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundcoefdata, propdata->nvbounddata);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundboundedidxdata, propdata->nvbounddata);
 
       /* free priority queue */
       SCIPpqueueFree(&propdata->propqueue);
@@ -1978,6 +1978,32 @@ SCIP_Real SCIPrandomGetReal(
    SCIP_Real             maxrandval          /**< maximal value to return */
    );
 
+/** fills an array with random integers between minrandval and maxrandval
+ *
+ *  The values are the same as the ones returned by nvals calls of SCIPrandomGetInt().
+ */
+SCIP_EXPORT
+void SCIPrandomGetInts(
+   SCIP_RANDNUMGEN*      randgen,            /**< random number generator data */
+   int                   minrandval,         /**< minimal value to return */
+   int                   maxrandval,         /**< maximal value to return */
+   int*                  vals,               /**< array to store the random integers */
+   int                   nvals               /**< number of random integers to draw */
+   );
+
+/** fills an array with random reals between minrandval and maxrandval
+ *
+ *  The values are the same as the ones returned by nvals calls of SCIPrandomGetReal().
+ */
+SCIP_EXPORT
+void SCIPrandomGetReals(
+   SCIP_RANDNUMGEN*      randgen,            /**< random number generator data */
+   SCIP_Real             minrandval,         /**< minimal value to return */
+   SCIP_Real             maxrandval,         /**< maximal value to return */
+   SCIP_Real*            vals,               /**< array to store the random reals */
+   int                   nvals               /**< number of random reals to draw */
+   );
+
 /** returns a random real between minrandval and maxrandval
  *
  *  @deprecated Please use SCIPrandomGetReal() to request a random real.
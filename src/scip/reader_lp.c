@@ -2624,19 +2624,34 @@ void appendLine(
    const char*           extension           /**< string to extent the line */
    )
 {
+   size_t len;
+
    assert( scip != NULL );
    assert( linebuffer != NULL );
    assert( linecnt != NULL );
    assert( extension != NULL );
-   assert( strlen(linebuffer) + strlen(extension) < LP_MAX_PRINTLEN );
+   assert( strlen(linebuffer) == (size_t) *linecnt );
+
+   len = strlen(extension);
+
+   /* print the current line first if the extension does not fit; a long extension, e.g., a bilinear term with two long
+    * variable names, can exceed the space left after LP_PRINTLEN characters
+    */
+   if( (size_t) *linecnt + len >= LP_MAX_PRINTLEN )
+      endLine(scip, file, linebuffer, linecnt);
+
+   /* an extension that does not even fit into an empty line is truncated */
+   if( len >= LP_MAX_PRINTLEN )
+      len = LP_MAX_PRINTLEN - 1;
+   assert( (size_t) *linecnt + len < LP_MAX_PRINTLEN );
 
-   /* NOTE: avoid
-    *   sprintf(linebuffer, "%s%s", linebuffer, extension); 
-    * because of overlapping memory areas in memcpy used in sprintf.
+   /* the line length is known, so copy the extension directly to the end of the line instead of searching for the end
+    * with strncat()
     */
-   (void) strncat(linebuffer, extension, LP_MAX_PRINTLEN - strlen(linebuffer));
+   BMScopyMemoryArray(&linebuffer[*linecnt], extension, len);
+   linebuffer[*linecnt + (int) len] = '\0';
 
-   (*linecnt) += (int) strlen(extension);
+   (*linecnt) += (int) len;
 
    SCIPdebugMsg(scip, "linebuffer <%s>, length = %lu\n", linebuffer, (unsigned long)strlen(linebuffer));
 
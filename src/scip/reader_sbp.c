@@ -0,0 +1,769 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_sbp.c
+ * @ingroup DEFPLUGINS_READER
+ * @brief  file reader and writer for SCIP's binary problem format
+ *
+ * A file in SBP format consists of the following sections, which are stored without any padding:
+ *
+ *  - a header: the magic string "SCIPSBP" (8 bytes including the terminating zero), the format version, an
+ *    endianness marker, the objective sense, the number of variables, constraints, and nonzeros (all 32-bit integers),
+ *    the total length of the name table (64-bit integer), and the objective offset (double);
+ *  - the variables: arrays of the objective coefficients, lower bounds, and upper bounds (doubles) followed by an
+ *    array of the variable types (one byte each);
+ *  - the constraints: arrays of the left and right hand sides (doubles), the row start positions (32-bit integers,
+ *    one more than the number of constraints), the column indices (32-bit integers), and the coefficients (doubles)
+ *    of the constraint matrix in compressed sparse row format;
+ *  - the name table: the zero-terminated names of the problem, the variables, and the constraints.
+ *
+ * Infinite values are stored as plus or minus SCIP_REAL_MAX.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/cons_linear.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_linear.h"
+#include "scip/pub_reader.h"
+#include "scip/pub_var.h"
+#include "scip/reader_sbp.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_reader.h"
+#include "scip/scip_var.h"
+#include <stdint.h>
+#include <string.h>
+
+#define READER_NAME             "sbpreader"
+#define READER_DESC             "file reader and writer for SCIP's binary problem format"
+#define READER_EXTENSION        "sbp"
+
+#define SBP_MAGIC               "SCIPSBP"    /**< magic string at the beginning of each file (8 bytes with zero) */
+#define SBP_MAGICLEN            8            /**< length of the magic string including the terminating zero */
+#define SBP_VERSION             1            /**< version of the file format */
+#define SBP_ENDIANMARKER        0x01020304   /**< marker to detect files written with a different byte order */
+
+
+/*
+ * Data structures
+ */
+
+/** header of an SBP file */
+struct SbpHeader
+{
+   char                  magic[SBP_MAGICLEN];/**< magic string SBP_MAGIC */
+   int32_t               version;            /**< version of the file format */
+   int32_t               endianmarker;       /**< SBP_ENDIANMARKER in the byte order of the writing machine */
+   int32_t               objsense;           /**< objective sense: +1 for minimization, -1 for maximization */
+   int32_t               nvars;              /**< number of variables */
+   int32_t               nconss;             /**< number of constraints */
+   int32_t               nnonzs;             /**< number of nonzeros of the constraint matrix */
+   int64_t               namelen;            /**< total length of the name table */
+   double                objoffset;          /**< objective offset */
+};
+typedef struct SbpHeader SBPHEADER;
+
+
+/*
+ * Local methods
+ */
+
+/** reads an array of the given size from the file; returns FALSE if the file ended early */
+static
+SCIP_Bool readBlock(
+   SCIP_FILE*            file,               /**< file to read from */
+   void*                 ptr,                /**< memory to read into */
+   size_t                size,               /**< size of an element */
+   size_t                nmemb               /**< number of elements to read */
+   )
+{
+   if( nmemb == 0 )
+      return TRUE;
+
+   /* read bytes, since SCIPfread() returns the number of bytes instead of elements if compiled with zlib */
+   return SCIPfread(ptr, 1, size * nmemb, file) == size * nmemb;
+}
+
+/** writes an array of the given size to the file; returns FALSE if writing failed */
+static
+SCIP_Bool writeBlock(
+   FILE*                 file,               /**< file to write to */
+   const void*           ptr,                /**< memory to write */
+   size_t                size,               /**< size of an element */
+   size_t                nmemb               /**< number of elements to write */
+   )
+{
+   if( nmemb == 0 )
+      return TRUE;
+
+   return fwrite(ptr, size, nmemb, file) == nmemb;
+}
+
+/** converts a value read from the file into SCIP's value range */
+static
+SCIP_Real readValue(
+   SCIP*                 scip,               /**< SCIP data structure */
+   double                val                 /**< value stored in the file */
+   )
+{
+   if( SCIPisInfinity(scip, val) )
+      return SCIPinfinity(scip);
+   if( SCIPisInfinity(scip, -val) )
+      return -SCIPinfinity(scip);
+   return (SCIP_Real)val;
+}
+
+/** converts a value of SCIP into the value stored in the file */
+static
+double writeValue(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             val                 /**< value to store */
+   )
+{
+   if( SCIPisInfinity(scip, val) )
+      return SCIP_REAL_MAX;
+   if( SCIPisInfinity(scip, -val) )
+      return -SCIP_REAL_MAX;
+   return (double)val;
+}
+
+/** returns the next name from the name table or NULL if the name table is exhausted */
+static
+const char* nextName(
+   const char*           names,              /**< name table */
+   int64_t               namelen,            /**< total length of the name table */
+   int64_t*              pos                 /**< pointer to current position in the name table, updated */
+   )
+{
+   const char* name;
+   const char* end;
+
+   assert(pos != NULL);
+
+   if( *pos >= namelen )
+      return NULL;
+
+   name = names + *pos;
+   end = (const char*)memchr(name, '\0', (size_t)(namelen - *pos));
+   if( end == NULL )
+      return NULL;
+
+   *pos += (end - name) + 1;
+
+   return name;
+}
+
+/** reads the problem from an opened SBP file */
+static
+SCIP_RETCODE readSbp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_FILE*            file,               /**< file to read from */
+   const char*           filename            /**< name of the input file */
+   )
+{
+   SBPHEADER header;
+   SCIP_VAR** vars = NULL;
+   SCIP_VAR** consvars = NULL;
+   SCIP_CONS** conss = NULL;
+   const char** consnames = NULL;
+   double* obj = NULL;
+   double* lb = NULL;
+   double* ub = NULL;
+   char* vartypes = NULL;
+   double* lhs = NULL;
+   double* rhs = NULL;
+   int* beg = NULL;
+   int* ind = NULL;
+   double* val = NULL;
+   char* names = NULL;
+   const char* name;
+   SCIP_Bool initialconss;
+   SCIP_Bool dynamicconss;
+   SCIP_Bool dynamiccols;
+   SCIP_Bool dynamicrows;
+   SCIP_Bool success;
+   int64_t namepos;
+   int nvarscreated;
+   int i;
+   int j;
+
+   assert(scip != NULL);
+   assert(file != NULL);
+
+   /* read and check the header */
+   if( !readBlock(file, &header, sizeof(header), 1) || memcmp(header.magic, SBP_MAGIC, SBP_MAGICLEN) != 0 )
+   {
+      SCIPerrorMessage("file <%s> is not in SBP format\n", filename);
+      return SCIP_READERROR;
+   }
+   if( header.endianmarker != SBP_ENDIANMARKER )
+   {
+      SCIPerrorMessage("file <%s> was written on a machine with a different byte order\n", filename);
+      return SCIP_READERROR;
+   }
+   if( header.version != SBP_VERSION )
+   {
+      SCIPerrorMessage("file <%s> has unsupported SBP format version %d\n", filename, (int)header.version);
+      return SCIP_READERROR;
+   }
+   if( header.nvars < 0 || header.nconss < 0 || header.nconss == INT32_MAX || header.nnonzs < 0
+      || header.namelen < 0 || header.namelen >= INT32_MAX || (header.objsense != 1 && header.objsense != -1) )
+   {
+      SCIPerrorMessage("file <%s> has an invalid SBP header\n", filename);
+      return SCIP_READERROR;
+   }
+
+   /* read all arrays in one block each */
+   SCIP_CALL( SCIPallocBufferArray(scip, &obj, header.nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lb, header.nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ub, header.nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vartypes, header.nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhs, header.nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhs, header.nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &beg, header.nconss + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ind, header.nnonzs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &val, header.nnonzs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, header.namelen + 1) );
+
+   success = readBlock(file, obj, sizeof(double), (size_t)header.nvars);
+   success = success && readBlock(file, lb, sizeof(double), (size_t)header.nvars);
+   success = success && readBlock(file, ub, sizeof(double), (size_t)header.nvars);
+   success = success && readBlock(file, vartypes, sizeof(char), (size_t)header.nvars);
+   success = success && readBlock(file, lhs, sizeof(double), (size_t)header.nconss);
+   success = success && readBlock(file, rhs, sizeof(double), (size_t)header.nconss);
+   success = success && readBlock(file, beg, sizeof(int), (size_t)header.nconss + 1);
+   success = success && readBlock(file, ind, sizeof(int), (size_t)header.nnonzs);
+   success = success && readBlock(file, val, sizeof(double), (size_t)header.nnonzs);
+   success = success && readBlock(file, names, sizeof(char), (size_t)header.namelen);
+   names[header.namelen] = '\0';
+
+   if( !success )
+   {
+      SCIPerrorMessage("unexpected end of file <%s>\n", filename);
+      goto TERMINATE;
+   }
+
+   /* check the constraint matrix */
+   success = (beg[0] == 0 && beg[header.nconss] == header.nnonzs);
+   for( i = 0; i < header.nconss && success; ++i )
+      success = (beg[i] <= beg[i+1]);
+   for( j = 0; j < header.nnonzs && success; ++j )
+      success = (ind[j] >= 0 && ind[j] < header.nvars);
+   for( j = 0; j < header.nvars && success; ++j )
+   {
+      success = (vartypes[j] == (char)SCIP_VARTYPE_BINARY || vartypes[j] == (char)SCIP_VARTYPE_INTEGER
+         || vartypes[j] == (char)SCIP_VARTYPE_IMPLINT || vartypes[j] == (char)SCIP_VARTYPE_CONTINUOUS);
+   }
+
+   if( !success )
+   {
+      SCIPerrorMessage("file <%s> contains invalid data\n", filename);
+      goto TERMINATE;
+   }
+
+   /* create the problem */
+   namepos = 0;
+   name = nextName(names, header.namelen, &namepos);
+   SCIP_CALL( SCIPcreateProb(scip, name != NULL && name[0] != '\0' ? name : filename, NULL, NULL, NULL, NULL, NULL,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetObjsense(scip, header.objsense == -1 ? SCIP_OBJSENSE_MAXIMIZE : SCIP_OBJSENSE_MINIMIZE) );
+   if( header.objoffset != 0.0 )
+   {
+      SCIP_CALL( SCIPaddOrigObjoffset(scip, header.objoffset) );
+   }
+
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/initialconss", &initialconss) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicconss", &dynamicconss) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamiccols", &dynamiccols) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicrows", &dynamicrows) );
+
+   /* create the variables */
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, header.nvars) );
+   for( nvarscreated = 0; nvarscreated < header.nvars; ++nvarscreated )
+   {
+      name = nextName(names, header.namelen, &namepos);
+      if( name == NULL )
+      {
+         success = FALSE;
+         break;
+      }
+
+      j = nvarscreated;
+      SCIP_CALL( SCIPcreateVar(scip, &vars[j], name, readValue(scip, lb[j]), readValue(scip, ub[j]), obj[j],
+            (SCIP_VARTYPE)vartypes[j], !dynamiccols, dynamiccols, NULL, NULL, NULL, NULL, NULL) );
+      SCIP_CALL( SCIPaddVar(scip, vars[j]) );
+   }
+
+   /* collect the names of the constraints */
+   SCIP_CALL( SCIPallocBufferArray(scip, &consnames, header.nconss) );
+   for( i = 0; i < header.nconss && success; ++i )
+   {
+      consnames[i] = nextName(names, header.namelen, &namepos);
+      success = (consnames[i] != NULL);
+   }
+
+   /* create all constraints at once from the constraint matrix */
+   if( success )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &consvars, header.nnonzs) );
+      for( j = 0; j < header.nnonzs; ++j )
+         consvars[j] = vars[ind[j]];
+
+      for( i = 0; i < header.nconss; ++i )
+      {
+         lhs[i] = readValue(scip, lhs[i]);
+         rhs[i] = readValue(scip, rhs[i]);
+      }
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &conss, header.nconss) );
+      SCIP_CALL( SCIPcreateConssLinear(scip, conss, header.nconss, consnames, beg, consvars, val, lhs, rhs,
+            initialconss, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, dynamicconss, dynamicrows, FALSE) );
+
+      for( i = 0; i < header.nconss; ++i )
+      {
+         SCIP_CALL( SCIPaddCons(scip, conss[i]) );
+         SCIP_CALL( SCIPreleaseCons(scip, &conss[i]) );
+      }
+   }
+
+   /* release the variables */
+   for( j = 0; j < nvarscreated; ++j )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[j]) );
+   }
+
+   if( !success )
+   {
+      SCIPerrorMessage("name table of file <%s> is too short\n", filename);
+   }
+
+ TERMINATE:
+   SCIPfreeBufferArrayNull(scip, &conss);
+   SCIPfreeBufferArrayNull(scip, &consvars);
+   SCIPfreeBufferArrayNull(scip, &consnames);
+   SCIPfreeBufferArrayNull(scip, &vars);
+   SCIPfreeBufferArray(scip, &names);
+   SCIPfreeBufferArray(scip, &val);
+   SCIPfreeBufferArray(scip, &ind);
+   SCIPfreeBufferArray(scip, &beg);
+   SCIPfreeBufferArray(scip, &rhs);
+   SCIPfreeBufferArray(scip, &lhs);
+   SCIPfreeBufferArray(scip, &vartypes);
+   SCIPfreeBufferArray(scip, &ub);
+   SCIPfreeBufferArray(scip, &lb);
+   SCIPfreeBufferArray(scip, &obj);
+
+   return success ? SCIP_OKAY : SCIP_READERROR;
+}
+
+/** transforms the given variables into active (or, for the original problem, original) variables and collects the
+ *  constant into the given sides
+ */
+static
+SCIP_RETCODE getActiveVars(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR***           activevars,         /**< pointer to buffer array of variables, transformed in place */
+   SCIP_Real**           activevals,         /**< pointer to buffer array of coefficients, transformed in place */
+   int*                  nactivevars,        /**< pointer to number of variables, updated */
+   SCIP_Bool             transformed,        /**< transformed constraint? */
+   SCIP_Real*            constant            /**< pointer to store the constant of the linear sum */
+   )
+{
+   int requiredsize;
+   int v;
+
+   *constant = 0.0;
+
+   if( transformed )
+   {
+      SCIP_CALL( SCIPgetProbvarLinearSum(scip, *activevars, *activevals, nactivevars, *nactivevars, constant,
+            &requiredsize, TRUE) );
+
+      if( requiredsize > *nactivevars )
+      {
+         SCIP_CALL( SCIPreallocBufferArray(scip, activevars, requiredsize) );
+         SCIP_CALL( SCIPreallocBufferArray(scip, activevals, requiredsize) );
+
+         SCIP_CALL( SCIPgetProbvarLinearSum(scip, *activevars, *activevals, nactivevars, requiredsize, constant,
+               &requiredsize, TRUE) );
+         assert(requiredsize <= *nactivevars);
+      }
+   }
+   else
+   {
+      for( v = 0; v < *nactivevars; ++v )
+      {
+         SCIP_CALL( SCIPvarGetOrigvarSum(&(*activevars)[v], &(*activevals)[v], constant) );
+
+         /* negated variables with an original counterpart may also be returned by SCIPvarGetOrigvarSum();
+          * make sure we get the original variable in that case
+          */
+         if( SCIPvarGetStatus((*activevars)[v]) == SCIP_VARSTATUS_NEGATED )
+         {
+            (*activevars)[v] = SCIPvarGetNegatedVar((*activevars)[v]);
+            (*activevals)[v] *= -1.0;
+            *constant += 1.0;
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** adds a name to the name table */
+static
+SCIP_RETCODE appendName(
+   SCIP*                 scip,               /**< SCIP data structure */
+   char**                names,              /**< pointer to buffer array of the name table */
+   int64_t*              namelen,            /**< pointer to length of the name table */
+   int*                  namessize,          /**< pointer to size of the name table */
+   const char*           name                /**< name to add */
+   )
+{
+   size_t len;
+
+   len = strlen(name) + 1;
+
+   if( *namelen + (int64_t)len > *namessize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, (int)(*namelen + (int64_t)len));
+      SCIP_CALL( SCIPreallocBufferArray(scip, names, newsize) );
+      *namessize = newsize;
+   }
+
+   BMScopyMemoryArray(*names + *namelen, name, len);
+   *namelen += (int64_t)len;
+
+   return SCIP_OKAY;
+}
+
+/** writes the problem in SBP format */
+static
+SCIP_RETCODE writeSbp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< problem name */
+   SCIP_Bool             transformed,        /**< TRUE iff problem is the transformed problem */
+   SCIP_OBJSENSE         objsense,           /**< objective sense */
+   SCIP_Real             objscale,           /**< scalar applied to objective function */
+   SCIP_Real             objoffset,          /**< objective offset from bound shifting and fixing */
+   SCIP_VAR**            vars,               /**< array with active variables ordered binary, integer, implicit, continuous */
+   int                   nvars,              /**< number of active variables in the problem */
+   SCIP_CONS**           conss,              /**< array with constraints of the problem */
+   int                   nconss,             /**< number of constraints in the problem */
+   SCIP_RESULT*          result              /**< pointer to store the result of the file writing call */
+   )
+{
+   SBPHEADER header;
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   double* obj;
+   double* lb;
+   double* ub;
+   char* vartypes;
+   double* lhs;
+   double* rhs;
+   int* beg;
+   int* ind;
+   double* val;
+   char* names;
+   int64_t namelen;
+   int namessize;
+   int nnonzs;
+   int nonzssize;
+   SCIP_RETCODE retcode;
+   SCIP_Bool success;
+   int c;
+   int v;
+
+   assert(scip != NULL);
+   assert(file != NULL);
+   assert(result != NULL);
+
+   retcode = SCIP_OKAY;
+   *result = SCIP_SUCCESS;
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), MAX(nvars, 1)) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &obj, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lb, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ub, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vartypes, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhs, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhs, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &beg, nconss + 1) );
+
+   nonzssize = SCIPcalcMemGrowSize(scip, MAX(nvars, 1));
+   SCIP_CALL( SCIPallocBufferArray(scip, &ind, nonzssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &val, nonzssize) );
+
+   namessize = SCIPcalcMemGrowSize(scip, 16 * (nvars + nconss + 1));
+   SCIP_CALL( SCIPallocBufferArray(scip, &names, namessize) );
+   namelen = 0;
+   SCIP_CALL( appendName(scip, &names, &namelen, &namessize, name) );
+
+   /* collect the variables */
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(varmap, vars[v], v) );
+
+      obj[v] = writeValue(scip, objscale * SCIPvarGetObj(vars[v]));
+      lb[v] = writeValue(scip, transformed ? SCIPvarGetLbLocal(vars[v]) : SCIPvarGetLbOriginal(vars[v]));
+      ub[v] = writeValue(scip, transformed ? SCIPvarGetUbLocal(vars[v]) : SCIPvarGetUbOriginal(vars[v]));
+      vartypes[v] = (char)SCIPvarGetType(vars[v]);
+
+      SCIP_CALL( appendName(scip, &names, &namelen, &namessize, SCIPvarGetName(vars[v])) );
+   }
+
+   /* collect the constraint matrix */
+   nnonzs = 0;
+   beg[0] = 0;
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_CONS* cons;
+      SCIP_Real constant = 0.0;
+      SCIP_Real conslhs = 0.0;
+      SCIP_Real consrhs = 0.0;
+      int nconsvars;
+
+      cons = conss[c];
+      assert(cons != NULL);
+
+      SCIP_CALL( SCIPgetConsNVars(scip, cons, &nconsvars, &success) );
+      if( success )
+         conslhs = SCIPconsGetLhs(scip, cons, &success);
+      if( success )
+         consrhs = SCIPconsGetRhs(scip, cons, &success);
+
+      if( !success )
+      {
+         SCIPerrorMessage("constraint <%s> of type <%s> has no linear representation and cannot be written in SBP "
+            "format\n", SCIPconsGetName(cons), SCIPconshdlrGetName(SCIPconsGetHdlr(cons)));
+         retcode = SCIP_WRITEERROR;
+         break;
+      }
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &consvars, MAX(nconsvars, 1)) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &consvals, MAX(nconsvars, 1)) );
+
+      SCIP_CALL( SCIPgetConsVars(scip, cons, consvars, nconsvars, &success) );
+      if( success )
+      {
+         SCIP_CALL( SCIPgetConsVals(scip, cons, consvals, nconsvars, &success) );
+      }
+
+      if( success )
+      {
+         SCIP_CALL( getActiveVars(scip, &consvars, &consvals, &nconsvars, transformed, &constant) );
+
+         if( nnonzs + nconsvars > nonzssize )
+         {
+            nonzssize = SCIPcalcMemGrowSize(scip, nnonzs + nconsvars);
+            SCIP_CALL( SCIPreallocBufferArray(scip, &ind, nonzssize) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &val, nonzssize) );
+         }
+
+         for( v = 0; v < nconsvars; ++v )
+         {
+            if( !SCIPhashmapExists(varmap, consvars[v]) )
+            {
+               SCIPerrorMessage("constraint <%s> contains variable <%s> that is not part of the problem\n",
+                  SCIPconsGetName(cons), SCIPvarGetName(consvars[v]));
+               success = FALSE;
+               break;
+            }
+
+            ind[nnonzs] = SCIPhashmapGetImageInt(varmap, consvars[v]);
+            val[nnonzs] = consvals[v];
+            ++nnonzs;
+         }
+
+         if( !SCIPisInfinity(scip, -conslhs) )
+            conslhs -= constant;
+         if( !SCIPisInfinity(scip, consrhs) )
+            consrhs -= constant;
+      }
+
+      SCIPfreeBufferArray(scip, &consvals);
+      SCIPfreeBufferArray(scip, &consvars);
+
+      if( !success )
+      {
+         retcode = SCIP_WRITEERROR;
+         break;
+      }
+
+      lhs[c] = writeValue(scip, conslhs);
+      rhs[c] = writeValue(scip, consrhs);
+      beg[c+1] = nnonzs;
+
+      SCIP_CALL( appendName(scip, &names, &namelen, &namessize, SCIPconsGetName(cons)) );
+   }
+
+   if( retcode == SCIP_OKAY )
+   {
+      /* write the header and all arrays */
+      BMSclearMemory(&header);
+      (void) strncpy(header.magic, SBP_MAGIC, SBP_MAGICLEN);
+      header.version = SBP_VERSION;
+      header.endianmarker = SBP_ENDIANMARKER;
+      header.objsense = (objsense == SCIP_OBJSENSE_MAXIMIZE ? -1 : 1);
+      header.nvars = nvars;
+      header.nconss = nconss;
+      header.nnonzs = nnonzs;
+      header.namelen = namelen;
+      header.objoffset = objscale * objoffset;
+
+      success = writeBlock(file, &header, sizeof(header), 1);
+      success = success && writeBlock(file, obj, sizeof(double), (size_t)nvars);
+      success = success && writeBlock(file, lb, sizeof(double), (size_t)nvars);
+      success = success && writeBlock(file, ub, sizeof(double), (size_t)nvars);
+      success = success && writeBlock(file, vartypes, sizeof(char), (size_t)nvars);
+      success = success && writeBlock(file, lhs, sizeof(double), (size_t)nconss);
+      success = success && writeBlock(file, rhs, sizeof(double), (size_t)nconss);
+      success = success && writeBlock(file, beg, sizeof(int), (size_t)nconss + 1);
+      success = success && writeBlock(file, ind, sizeof(int), (size_t)nnonzs);
+      success = success && writeBlock(file, val, sizeof(double), (size_t)nnonzs);
+      success = success && writeBlock(file, names, sizeof(char), (size_t)namelen);
+
+      if( !success )
+      {
+         SCIPerrorMessage("error while writing SBP file\n");
+         retcode = SCIP_WRITEERROR;
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &names);
+   SCIPfreeBufferArray(scip, &val);
+   SCIPfreeBufferArray(scip, &ind);
+   SCIPfreeBufferArray(scip, &beg);
+   SCIPfreeBufferArray(scip, &rhs);
+   SCIPfreeBufferArray(scip, &lhs);
+   SCIPfreeBufferArray(scip, &vartypes);
+   SCIPfreeBufferArray(scip, &ub);
+   SCIPfreeBufferArray(scip, &lb);
+   SCIPfreeBufferArray(scip, &obj);
+
+   SCIPhashmapFree(&varmap);
+
+   return retcode;
+}
+
+
+/*
+ * Callback methods of reader
+ */
+
+/** copy method for reader plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_READERCOPY(readerCopySbp)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   /* call inclusion method of reader */
+   SCIP_CALL( SCIPincludeReaderSbp(scip) );
+
+   return SCIP_OKAY;
+}
+
+
+/** problem reading method of reader */
+static
+SCIP_DECL_READERREAD(readerReadSbp)
+{  /*lint --e{715}*/
+   SCIP_FILE* f;
+   SCIP_RETCODE retcode;
+
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+   assert(filename != NULL);
+   assert(result != NULL);
+
+   /* open file */
+   f = SCIPfopen(filename, "rb");
+   if( f == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_NOFILE;
+   }
+
+   /* read sbp file */
+   retcode = readSbp(scip, f, filename);
+
+   /* close file */
+   SCIPfclose(f);
+
+   *result = SCIP_SUCCESS;
+
+   return retcode;
+}
+
+
+/** problem writing method of reader */
+static
+SCIP_DECL_READERWRITE(readerWriteSbp)
+{  /*lint --e{715}*/
+   assert(reader != NULL);
+   assert(strcmp(SCIPreaderGetName(reader), READER_NAME) == 0);
+
+   if( file == stdout )
+   {
+      SCIPerrorMessage("SBP format is binary and cannot be written to standard output\n");
+      return SCIP_WRITEERROR;
+   }
+
+   SCIP_CALL( writeSbp(scip, file, name, transformed, objsense, objscale, objoffset, vars, nvars, conss, nconss,
+         result) );
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * sbp file reader specific interface methods
+ */
+
+/** includes the sbp file reader in SCIP */
+SCIP_RETCODE SCIPincludeReaderSbp(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_READER* reader;
+
+   /* include reader */
+   SCIP_CALL( SCIPincludeReaderBasic(scip, &reader, READER_NAME, READER_DESC, READER_EXTENSION, NULL) );
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetReaderCopy(scip, reader, readerCopySbp) );
+   SCIP_CALL( SCIPsetReaderRead(scip, reader, readerReadSbp) );
+   SCIP_CALL( SCIPsetReaderWrite(scip, reader, readerWriteSbp) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   reader_sbp.h
+ * @ingroup FILEREADERS
+ * @brief  file reader and writer for SCIP's binary problem format
+ *
+ * The SBP (SCIP binary problem) format stores a problem with linear constraints as arrays: the objective
+ * coefficients, bounds and types of the variables, the sides of the constraints, the constraint matrix in compressed
+ * sparse row format, and a table of the names. Reading such a file does not need any parsing; all arrays are read in
+ * one block each and the variables and linear constraints are created directly from them. This makes the format
+ * useful for reloading the same model many times, e.g., for solving several scenarios.
+ *
+ * All constraints that provide a linear representation via SCIPgetConsVars() and SCIPgetConsVals(), e.g., linear,
+ * set partitioning, logicor, knapsack, and variable bound constraints, are written as linear constraints. The file
+ * is written in the byte order of the machine and can only be read on machines with the same byte order.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_READER_SBP_H__
+#define __SCIP_READER_SBP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** includes the sbp file reader into SCIP
+ *
+ *  @ingroup FileReaderIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeReaderSbp(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
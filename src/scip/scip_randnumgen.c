@@ -43,6 +43,8 @@
 /** creates and initializes a random number generator
  *
  *  @note The initial seed is changed using SCIPinitializeRandomSeed()
+ *
+ *  @note The generator uses xoshiro256++ instead of KISS if the parameter randomization/usexoshiro is set
  */
 SCIP_RETCODE SCIPcreateRandom(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -62,6 +64,7 @@ SCIP_RETCODE SCIPcreateRandom(
       modifiedseed = initialseed;
 
    SCIP_CALL( SCIPrandomCreate(randnumgen, SCIPblkmem(scip), modifiedseed) );
+   SCIPrandomSetXoshiro(*randnumgen, scip->set->random_usexoshiro);
 
    return SCIP_OKAY;
 }
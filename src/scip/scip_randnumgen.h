@@ -49,6 +49,8 @@ extern "C" {
 /** creates and initializes a random number generator
  *
  *  @note The initial seed is changed using SCIPinitializeRandomSeed()
+ *
+ *  @note The generator uses xoshiro256++ instead of KISS if the parameter randomization/usexoshiro is set
  */
 SCIP_EXPORT
 SCIP_RETCODE SCIPcreateRandom(
@@ -4143,6 +4143,234 @@ SCIP_RETCODE SCIPprintStatistics(
    return SCIP_OKAY;
 }
 
+/** prints a real value as JSON number, or null if the value is infinite or invalid */
+static
+void printJsonReal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file (or NULL for standard output) */
+   SCIP_Real             val                 /**< value to print */
+   )
+{
+   if( val == SCIP_INVALID || SCIPisInfinity(scip, REALABS(val)) ) /*lint !e777*/
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "null");
+   else
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "%.15g", val);
+}
+
+/** prints a string as JSON string in double quotes, escaping quotes, backslashes, and control characters */
+static
+void printJsonString(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file (or NULL for standard output) */
+   const char*           str                 /**< string to print */
+   )
+{
+   char buffer[SCIP_MAXSTRLEN];
+   int len;
+
+   assert(str != NULL);
+
+   buffer[0] = '"';
+   len = 1;
+
+   for( ; *str != '\0'; ++str )
+   {
+      /* flush the buffer if an escaped character and the closing quote may not fit anymore */
+      if( len + 8 > SCIP_MAXSTRLEN )
+      {
+         buffer[len] = '\0';
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "%s", buffer);
+         len = 0;
+      }
+
+      if( *str == '"' || *str == '\\' )
+      {
+         buffer[len++] = '\\';
+         buffer[len++] = *str;
+      }
+      else if( (unsigned char)*str < 0x20 )
+         len += snprintf(buffer + len, 7, "\\u%04x", (unsigned int)(unsigned char)*str);
+      else
+         buffer[len++] = *str;
+   }
+
+   buffer[len++] = '"';
+   buffer[len] = '\0';
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "%s", buffer);
+}
+
+/** returns the solving status as text, as printed by SCIPprintStatus() */
+static
+const char* getStatusString(
+   SCIP_STATUS           status              /**< solving status */
+   )
+{
+   switch( status )
+   {
+   case SCIP_STATUS_UNKNOWN:
+      return "unknown";
+   case SCIP_STATUS_USERINTERRUPT:
+      return "user interrupt";
+   case SCIP_STATUS_NODELIMIT:
+      return "node limit reached";
+   case SCIP_STATUS_TOTALNODELIMIT:
+      return "total node limit reached";
+   case SCIP_STATUS_STALLNODELIMIT:
+      return "stall node limit reached";
+   case SCIP_STATUS_TIMELIMIT:
+      return "time limit reached";
+   case SCIP_STATUS_MEMLIMIT:
+      return "memory limit reached";
+   case SCIP_STATUS_GAPLIMIT:
+      return "gap limit reached";
+   case SCIP_STATUS_SOLLIMIT:
+      return "solution limit reached";
+   case SCIP_STATUS_BESTSOLLIMIT:
+      return "solution improvement limit reached";
+   case SCIP_STATUS_RESTARTLIMIT:
+      return "restart limit reached";
+   case SCIP_STATUS_OPTIMAL:
+      return "optimal solution found";
+   case SCIP_STATUS_INFEASIBLE:
+      return "infeasible";
+   case SCIP_STATUS_UNBOUNDED:
+      return "unbounded";
+   case SCIP_STATUS_INFORUNBD:
+      return "infeasible or unbounded";
+   case SCIP_STATUS_TERMINATE:
+      return "termination signal received";
+   default:
+      return "invalid";
+   }
+}
+
+/** outputs the main solving statistics and the statistics of all plugins as one JSON object
+ *
+ *  In contrast to SCIPprintStatistics(), the output is meant to be read by other programs, e.g., for monitoring the
+ *  progress of the solving process; it can also be called repeatedly during the solve, e.g., from an event handler.
+ *  Infinite or unknown values are written as null. Quotes, backslashes, and control characters in the status and the
+ *  plugin names are escaped.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ */
+SCIP_RETCODE SCIPprintStatisticsJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file                /**< output file (or NULL for standard output) */
+   )
+{
+   SCIP_MESSAGEHDLR* messagehdlr;
+   int i;
+
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPprintStatisticsJson", FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE) );
+
+   messagehdlr = scip->messagehdlr;
+
+   SCIPmessageFPrintInfo(messagehdlr, file, "{\n  \"status\": ");
+   printJsonString(scip, file, getStatusString(SCIPgetStatus(scip)));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"solvingtime\": ");
+   printJsonReal(scip, file, SCIPgetSolvingTime(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"presolvingtime\": ");
+   printJsonReal(scip, file, SCIPgetPresolvingTime(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"nruns\": %d", SCIPgetNRuns(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"nnodes\": %" SCIP_LONGINT_FORMAT, SCIPgetNTotalNodes(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"nlpiterations\": %" SCIP_LONGINT_FORMAT, SCIPgetNLPIterations(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"nsols\": %" SCIP_LONGINT_FORMAT, SCIPgetNSolsFound(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"primalbound\": ");
+   printJsonReal(scip, file, SCIPgetPrimalbound(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"dualbound\": ");
+   printJsonReal(scip, file, SCIPgetDualbound(scip));
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"gap\": ");
+   printJsonReal(scip, file, SCIPgetGap(scip));
+
+   /* presolver statistics */
+   SCIPmessageFPrintInfo(messagehdlr, file, ",\n  \"presolvers\": [");
+   for( i = 0; i < scip->set->npresols; ++i )
+   {
+      SCIP_PRESOL* presol = scip->set->presols[i];
+
+      SCIPmessageFPrintInfo(messagehdlr, file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+      printJsonString(scip, file, SCIPpresolGetName(presol));
+      SCIPmessageFPrintInfo(messagehdlr, file, ", \"time\": %.6f, \"ncalls\": %d, \"nfixedvars\": %d, "
+         "\"naggrvars\": %d, \"nchgbds\": %d, \"ndelconss\": %d, \"naddconss\": %d, \"nchgcoefs\": %d, \"nchgsides\": %d}",
+         SCIPpresolGetTime(presol), SCIPpresolGetNCalls(presol), SCIPpresolGetNFixedVars(presol),
+         SCIPpresolGetNAggrVars(presol), SCIPpresolGetNChgBds(presol), SCIPpresolGetNDelConss(presol),
+         SCIPpresolGetNAddConss(presol), SCIPpresolGetNChgCoefs(presol), SCIPpresolGetNChgSides(presol));
+   }
+
+   /* constraint handler statistics */
+   SCIPmessageFPrintInfo(messagehdlr, file, "\n  ],\n  \"constrainthandlers\": [");
+   for( i = 0; i < scip->set->nconshdlrs; ++i )
+   {
+      SCIP_CONSHDLR* conshdlr = scip->set->conshdlrs[i];
+
+      SCIPmessageFPrintInfo(messagehdlr, file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+      printJsonString(scip, file, SCIPconshdlrGetName(conshdlr));
+      SCIPmessageFPrintInfo(messagehdlr, file, ", \"nconss\": %d, \"septime\": %.6f, \"proptime\": %.6f, "
+         "\"enfolptime\": %.6f, \"checktime\": %.6f, \"nsepacalls\": %" SCIP_LONGINT_FORMAT ", \"npropcalls\": %"
+         SCIP_LONGINT_FORMAT ", \"nenfolpcalls\": %" SCIP_LONGINT_FORMAT ", \"ncheckcalls\": %" SCIP_LONGINT_FORMAT
+         ", \"ncutoffs\": %" SCIP_LONGINT_FORMAT ", \"ndomreds\": %" SCIP_LONGINT_FORMAT "}",
+         SCIPconshdlrGetNActiveConss(conshdlr), SCIPconshdlrGetSepaTime(conshdlr), SCIPconshdlrGetPropTime(conshdlr),
+         SCIPconshdlrGetEnfoLPTime(conshdlr), SCIPconshdlrGetCheckTime(conshdlr), SCIPconshdlrGetNSepaCalls(conshdlr),
+         SCIPconshdlrGetNPropCalls(conshdlr), SCIPconshdlrGetNEnfoLPCalls(conshdlr),
+         SCIPconshdlrGetNCheckCalls(conshdlr), SCIPconshdlrGetNCutoffs(conshdlr),
+         SCIPconshdlrGetNDomredsFound(conshdlr));
+   }
+
+   /* propagator statistics */
+   SCIPmessageFPrintInfo(messagehdlr, file, "\n  ],\n  \"propagators\": [");
+   for( i = 0; i < scip->set->nprops; ++i )
+   {
+      SCIP_PROP* prop = scip->set->props[i];
+
+      SCIPmessageFPrintInfo(messagehdlr, file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+      printJsonString(scip, file, SCIPpropGetName(prop));
+      SCIPmessageFPrintInfo(messagehdlr, file, ", \"time\": %.6f, \"ncalls\": %" SCIP_LONGINT_FORMAT
+         ", \"ncutoffs\": %" SCIP_LONGINT_FORMAT ", \"ndomreds\": %" SCIP_LONGINT_FORMAT "}",
+         SCIPpropGetTime(prop), SCIPpropGetNCalls(prop), SCIPpropGetNCutoffs(prop), SCIPpropGetNDomredsFound(prop));
+   }
+
+   /* separator statistics */
+   SCIPmessageFPrintInfo(messagehdlr, file, "\n  ],\n  \"separators\": [");
+   for( i = 0; i < scip->set->nsepas; ++i )
+   {
+      SCIP_SEPA* sepa = scip->set->sepas[i];
+
+      SCIPmessageFPrintInfo(messagehdlr, file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+      printJsonString(scip, file, SCIPsepaGetName(sepa));
+      SCIPmessageFPrintInfo(messagehdlr, file, ", \"time\": %.6f, \"ncalls\": %" SCIP_LONGINT_FORMAT
+         ", \"ncutoffs\": %" SCIP_LONGINT_FORMAT ", \"ncutsfound\": %" SCIP_LONGINT_FORMAT ", \"ncutsapplied\": %"
+         SCIP_LONGINT_FORMAT ", \"ndomreds\": %" SCIP_LONGINT_FORMAT "}",
+         SCIPsepaGetTime(sepa), SCIPsepaGetNCalls(sepa), SCIPsepaGetNCutoffs(sepa), SCIPsepaGetNCutsFound(sepa),
+         SCIPsepaGetNCutsApplied(sepa), SCIPsepaGetNDomredsFound(sepa));
+   }
+
+   /* primal heuristic statistics */
+   SCIPmessageFPrintInfo(messagehdlr, file, "\n  ],\n  \"heuristics\": [");
+   for( i = 0; i < scip->set->nheurs; ++i )
+   {
+      SCIP_HEUR* heur = scip->set->heurs[i];
+
+      SCIPmessageFPrintInfo(messagehdlr, file, "%s\n    {\"name\": ", i > 0 ? "," : "");
+      printJsonString(scip, file, SCIPheurGetName(heur));
+      SCIPmessageFPrintInfo(messagehdlr, file, ", \"time\": %.6f, \"ncalls\": %" SCIP_LONGINT_FORMAT
+         ", \"nsolsfound\": %" SCIP_LONGINT_FORMAT ", \"nbestsolsfound\": %" SCIP_LONGINT_FORMAT "}",
+         SCIPheurGetTime(heur), SCIPheurGetNCalls(heur), SCIPheurGetNSolsFound(heur), SCIPheurGetNBestSolsFound(heur));
+   }
+   SCIPmessageFPrintInfo(messagehdlr, file, "\n  ]\n}\n");
+
+   return SCIP_OKAY;
+}
+
 /** outputs reoptimization statistics
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
@@ -207,6 +207,7 @@
 #include "scip/reader_ppm.h"
 #include "scip/reader_pbm.h"
 #include "scip/reader_rlp.h"
+#include "scip/reader_sbp.h"
 #include "scip/reader_smps.h"
 #include "scip/reader_sol.h"
 #include "scip/reader_sto.h"
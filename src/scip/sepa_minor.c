@@ -496,6 +496,39 @@ SCIP_RETCODE detectMinors(
    return SCIP_OKAY;
 }
 
+/** checks whether the augmented quadratic form matrix of a minor is positive definite
+ *
+ *  By Sylvester's criterion, the matrix
+ *                     (1 x  y )
+ *                     (x xx xy)
+ *                     (y xy yy)
+ *  is positive definite if and only if its leading principal minors xx - x^2 and its determinant are positive. In this
+ *  case, no eigenvalue is negative and no cut can be generated, so that the eigenvalue computation can be skipped. To be
+ *  safe against cancellation, the minors have to be positive relative to the sum of the absolute values of their terms.
+ */
+static
+SCIP_Bool isMinorMatrixPosDef(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             x,                  /**< solution value of x */
+   SCIP_Real             y,                  /**< solution value of y */
+   SCIP_Real             xx,                 /**< solution value of x*x */
+   SCIP_Real             yy,                 /**< solution value of y*y */
+   SCIP_Real             xy                  /**< solution value of x*y */
+   )
+{
+   SCIP_Real det;
+   SCIP_Real detabs;
+
+   if( xx - x * x <= SCIPepsilon(scip) * (REALABS(xx) + x * x) )
+      return FALSE;
+
+   /* determinant of the matrix and the sum of the absolute values of its terms */
+   det = xx * yy - xy * xy - x * x * yy + 2.0 * x * y * xy - y * y * xx;
+   detabs = REALABS(xx * yy) + xy * xy + x * x * REALABS(yy) + 2.0 * REALABS(x * y * xy) + y * y * REALABS(xx);
+
+   return det > SCIPepsilon(scip) * detabs;
+}
+
 /** helper method to compute eigenvectors and eigenvalues */
 static
 SCIP_RETCODE getEigenValues(
@@ -682,6 +715,10 @@ SCIP_RETCODE separatePoint(
       solxy = SCIPgetSolVal(scip, sol, xy);
       SCIPdebugMsg(scip, "solution values (x,y,xx,yy,xy)=(%g,%g,%g,%g,%g)\n", solx, soly, solxx, solyy, solxy);
 
+      /* a positive definite matrix has no negative eigenvalue that could give a cut */
+      if( isMinorMatrixPosDef(scip, solx, soly, solxx, solyy, solxy) )
+         continue;
+
       /* compute eigenvalues and eigenvectors */
       SCIP_CALL( getEigenValues(scip, solx, soly, solxx, solyy, solxy, eigenvals, eigenvecs, &success) );
       if( !success )
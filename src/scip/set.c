@@ -311,6 +311,8 @@
 #define SCIP_DEFAULT_RANDOM_LPSEED            0 /**< random seed for LP solver, e.g. for perturbations in the simplex (0: LP default) */
 #define SCIP_DEFAULT_RANDOM_PERMUTECONSS   TRUE /**< should order of constraints be permuted (depends on permutationseed)? */
 #define SCIP_DEFAULT_RANDOM_PERMUTEVARS   FALSE /**< should order of variables be permuted (depends on permutationseed)? */
+#define SCIP_DEFAULT_RANDOM_USEXOSHIRO    FALSE /**< should the random number generators of the plugins use xoshiro256++
+                                                 *   instead of KISS? */
 
 
 /* Node Selection */
@@ -457,8 +459,11 @@
 /* Concurrent solvers */
 #define SCIP_DEFAULT_CONCURRENT_CHANGESEEDS     TRUE /**< should the concurrent solvers use different random seeds? */
 #define SCIP_DEFAULT_CONCURRENT_CHANGECHILDSEL  TRUE /**< should the concurrent solvers use different child selection rules? */
+#define SCIP_DEFAULT_CONCURRENT_CHANGENODESEL  FALSE /**< should the concurrent solvers use different node selection rules? */
 #define SCIP_DEFAULT_CONCURRENT_COMMVARBNDS     TRUE /**< should the concurrent solvers communicate variable bounds? */
 #define SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE  TRUE /**< should the problem be presolved before it is copied to the concurrent solvers? */
+#define SCIP_DEFAULT_CONCURRENT_CHUNKPOOLSIZE    0.0 /**< maximal memory in MB of the chunk pool shared by the concurrent solvers
+                                                      *   (0.0: each solver frees its unused chunks) */
 #define SCIP_DEFAULT_CONCURRENT_INITSEED     5131912 /**< the seed used to initialize the random seeds for the concurrent solvers */
 #define SCIP_DEFAULT_CONCURRENT_FREQINIT        10.0 /**< initial frequency of synchronization with other threads
                                                       *   (fraction of time required for solving the root LP) */
@@ -468,6 +473,8 @@
 #define SCIP_DEFAULT_CONCURRENT_TARGETPROGRESS 0.001 /**< when adapting the synchronization frequency this value is the targeted
                                                        *   relative difference by which the absolute gap decreases per synchronization */
 #define SCIP_DEFAULT_CONCURRENT_MAXNSOLS           3 /**< maximum number of solutions that will be shared in a single synchronization */
+#define SCIP_DEFAULT_CONCURRENT_ASYNCSOLS      FALSE /**< should improving solutions be shared immediately instead of at the next
+                                                      *   synchronization (only in opportunistic mode)? */
 #define SCIP_DEFAULT_CONCURRENT_MAXNSYNCDELAY      7 /**< maximum number of synchronizations before reading is enforced regardless of delay */
 #define SCIP_DEFAULT_CONCURRENT_MINSYNCDELAY    10.0 /**< minimum delay before synchronization data is read */
 #define SCIP_DEFAULT_CONCURRENT_NBESTSOLS         10 /**< how many of the N best solutions should be considered for synchronization */
@@ -2067,6 +2074,13 @@ SCIP_RETCODE SCIPsetCreate(
          &(*set)->random_randomseed, FALSE, SCIP_DEFAULT_RANDOM_LPSEED, 0, INT_MAX,
          NULL, NULL) );
 
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "randomization/usexoshiro",
+         "should the random number generators of the plugins use xoshiro256++ instead of KISS (changes all random "
+         "streams)?",
+         &(*set)->random_usexoshiro, TRUE, SCIP_DEFAULT_RANDOM_USEXOSHIRO,
+         NULL, NULL) );
+
    /* node selection */
    SCIP_CALL( SCIPsetAddCharParam(*set, messagehdlr, blkmem,
          "nodeselection/childsel",
@@ -2536,6 +2550,11 @@ SCIP_RETCODE SCIPsetCreate(
          "use different child selection rules in each concurrent solver?",
          &(*set)->concurrent_changechildsel, FALSE, SCIP_DEFAULT_CONCURRENT_CHANGECHILDSEL,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/changenodesel",
+         "use different node selection rules in each concurrent solver to explore different parts of the tree?",
+         &(*set)->concurrent_changenodesel, FALSE, SCIP_DEFAULT_CONCURRENT_CHANGENODESEL,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "concurrent/commvarbnds",
          "should the concurrent solvers communicate global variable bound changes?",
@@ -2546,6 +2565,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should the problem be presolved before it is copied to the concurrent solvers?",
          &(*set)->concurrent_presolvebefore, FALSE, SCIP_DEFAULT_CONCURRENT_PRESOLVEBEFORE,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "concurrent/chunkpoolsize",
+         "maximal memory in MB of the pool in which the concurrent solvers share unused block memory chunks (0.0: no pool)",
+         &(*set)->concurrent_chunkpoolsize, FALSE, SCIP_DEFAULT_CONCURRENT_CHUNKPOOLSIZE, 0.0, (SCIP_Real)SCIP_MEM_NOLIMIT,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "concurrent/initseed",
          "maximum number of solutions that will be shared in a one synchronization",
@@ -2576,6 +2600,11 @@ SCIP_RETCODE SCIPsetCreate(
          "maximum number of solutions that will be shared in a single synchronization",
          &(*set)->concurrent_maxnsols, FALSE, SCIP_DEFAULT_CONCURRENT_MAXNSOLS, 0, 1000,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "concurrent/sync/asyncsols",
+         "should improving solutions be shared immediately instead of at the next synchronization (only in opportunistic mode)?",
+         &(*set)->concurrent_asyncsols, FALSE, SCIP_DEFAULT_CONCURRENT_ASYNCSOLS,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "concurrent/sync/maxnsyncdelay",
          "maximum number of synchronizations before reading is enforced regardless of delay",
@@ -35,11 +35,13 @@
  * #define SORTTPL_PTRCOMP                 ptrcomp method should be used for comparisons (optional)
  * #define SORTTPL_INDCOMP                 indcomp method should be used for comparisons (optional)
  * #define SORTTPL_BACKWARDS               should the array be sorted other way around
+ * #define SORTTPL_RADIXSORT               should large arrays be sorted by radix sort; requires int keys (optional)
  */
 #include "scip/def.h"
 #include "scip/dbldblarith.h"
 #define SORTTPL_SHELLSORTMAX    25 /* maximal size for shell sort */
 #define SORTTPL_MINSIZENINTHER 729 /* minimum input size to use ninther (median of nine) for pivot selection */
+#define SORTTPL_RADIXSORTMIN  8192 /* minimal size for radix sort */
 
 #ifndef SORTTPL_NAMEEXT
 #error You need to define SORTTPL_NAMEEXT.
@@ -47,6 +49,9 @@
 #ifndef SORTTPL_KEYTYPE
 #error You need to define SORTTPL_KEYTYPE.
 #endif
+#if defined(SORTTPL_RADIXSORT) && (defined(SORTTPL_PTRCOMP) || defined(SORTTPL_INDCOMP))
+#error SORTTPL_RADIXSORT cannot be used together with a comparator.
+#endif
 
 #ifdef SORTTPL_EXPANDNAME
 #undef SORTTPL_EXPANDNAME
@@ -565,6 +570,148 @@ void SORTTPL_NAME(sorttpl_checkSort, SORTTPL_NAMEEXT)
 }
 #endif
 
+#ifdef SORTTPL_RADIXSORT
+/** permutes an additional field according to the given permutation, using the given buffer for a copy of the field */
+#define SORTTPL_RADIXPERMUTE(T, field)                  \
+   {                                                    \
+      T* tmpfield = (T*)fieldbuffer;                    \
+      BMScopyMemoryArray(tmpfield, field, len);         \
+      for( i = 0; i < len; ++i )                        \
+         field[i] = tmpfield[perm[i]];                  \
+   }
+
+/** sorts an array of int keys by a least significant digit radix sort on bytes and performs the same permutation on
+ *  the additional fields; returns FALSE without changing the arrays if the auxiliary memory cannot be allocated
+ */
+static
+SCIP_Bool SORTTPL_NAME(sorttpl_radixSort, SORTTPL_NAMEEXT)
+(
+   SORTTPL_KEYTYPE*      key,                /**< pointer to data array that defines the order */
+   SORTTPL_HASFIELD1PAR(  SORTTPL_FIELD1TYPE*    field1 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD2PAR(  SORTTPL_FIELD2TYPE*    field2 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD3PAR(  SORTTPL_FIELD3TYPE*    field3 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD4PAR(  SORTTPL_FIELD4TYPE*    field4 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD5PAR(  SORTTPL_FIELD5TYPE*    field5 )      /**< additional field that should be sorted in the same way */
+   SORTTPL_HASFIELD6PAR(  SORTTPL_FIELD6TYPE*    field6 )      /**< additional field that should be sorted in the same way */
+   int                   len                 /**< length of arrays */
+   )
+{
+   unsigned int* ukeys = NULL;
+   unsigned int* ukeysbuffer = NULL;
+   unsigned int* tmpukeys;
+   int* perm = NULL;
+   int* permbuffer = NULL;
+   int* tmpperm;
+   void* fieldbuffer = NULL;
+   size_t fieldsize = 0;
+   int count[256];
+   int pass;
+   int i;
+
+   assert(len > 0);
+
+   SORTTPL_HASFIELD1( fieldsize = MAX(fieldsize, sizeof(SORTTPL_FIELD1TYPE)); )
+   SORTTPL_HASFIELD2( fieldsize = MAX(fieldsize, sizeof(SORTTPL_FIELD2TYPE)); )
+   SORTTPL_HASFIELD3( fieldsize = MAX(fieldsize, sizeof(SORTTPL_FIELD3TYPE)); )
+   SORTTPL_HASFIELD4( fieldsize = MAX(fieldsize, sizeof(SORTTPL_FIELD4TYPE)); )
+   SORTTPL_HASFIELD5( fieldsize = MAX(fieldsize, sizeof(SORTTPL_FIELD5TYPE)); )
+   SORTTPL_HASFIELD6( fieldsize = MAX(fieldsize, sizeof(SORTTPL_FIELD6TYPE)); )
+
+   BMSallocMemoryArray(&ukeys, len);
+   BMSallocMemoryArray(&ukeysbuffer, len);
+   BMSallocMemoryArray(&perm, len);
+   BMSallocMemoryArray(&permbuffer, len);
+   if( fieldsize > 0 )
+      BMSallocMemorySize(&fieldbuffer, fieldsize * (size_t)len);
+
+   if( ukeys == NULL || ukeysbuffer == NULL || perm == NULL || permbuffer == NULL
+      || (fieldsize > 0 && fieldbuffer == NULL) )
+   {
+      BMSfreeMemoryNull(&fieldbuffer);
+      BMSfreeMemoryArrayNull(&permbuffer);
+      BMSfreeMemoryArrayNull(&perm);
+      BMSfreeMemoryArrayNull(&ukeysbuffer);
+      BMSfreeMemoryArrayNull(&ukeys);
+      return FALSE;
+   }
+
+   /* map the keys to unsigned integers that are ordered in the same way */
+   for( i = 0; i < len; ++i )
+   {
+#ifdef SORTTPL_BACKWARDS
+      ukeys[i] = ~((unsigned int)key[i] ^ 0x80000000u);
+#else
+      ukeys[i] = (unsigned int)key[i] ^ 0x80000000u;
+#endif
+      perm[i] = i;
+   }
+
+   /* sort stably by each byte, starting with the least significant one */
+   for( pass = 0; pass < 4; ++pass )
+   {
+      unsigned int shift = 8u * (unsigned int)pass;
+      int sum;
+      int b;
+
+      BMSclearMemoryArray(count, 256);
+      for( i = 0; i < len; ++i )
+         ++count[(ukeys[i] >> shift) & 0xffu];
+
+      /* all keys have the same byte, e.g., the high bytes of small keys, so there is nothing to do */
+      if( count[(ukeys[0] >> shift) & 0xffu] == len )
+         continue;
+
+      sum = 0;
+      for( b = 0; b < 256; ++b )
+      {
+         int c = count[b];
+         count[b] = sum;
+         sum += c;
+      }
+
+      for( i = 0; i < len; ++i )
+      {
+         int pos = count[(ukeys[i] >> shift) & 0xffu]++;
+
+         ukeysbuffer[pos] = ukeys[i];
+         permbuffer[pos] = perm[i];
+      }
+
+      tmpukeys = ukeys;
+      ukeys = ukeysbuffer;
+      ukeysbuffer = tmpukeys;
+      tmpperm = perm;
+      perm = permbuffer;
+      permbuffer = tmpperm;
+   }
+
+   /* write back the keys and permute the additional fields */
+   for( i = 0; i < len; ++i )
+   {
+#ifdef SORTTPL_BACKWARDS
+      key[i] = (SORTTPL_KEYTYPE)(int)(~ukeys[i] ^ 0x80000000u);
+#else
+      key[i] = (SORTTPL_KEYTYPE)(int)(ukeys[i] ^ 0x80000000u);
+#endif
+   }
+
+   SORTTPL_HASFIELD1( SORTTPL_RADIXPERMUTE(SORTTPL_FIELD1TYPE, field1) )
+   SORTTPL_HASFIELD2( SORTTPL_RADIXPERMUTE(SORTTPL_FIELD2TYPE, field2) )
+   SORTTPL_HASFIELD3( SORTTPL_RADIXPERMUTE(SORTTPL_FIELD3TYPE, field3) )
+   SORTTPL_HASFIELD4( SORTTPL_RADIXPERMUTE(SORTTPL_FIELD4TYPE, field4) )
+   SORTTPL_HASFIELD5( SORTTPL_RADIXPERMUTE(SORTTPL_FIELD5TYPE, field5) )
+   SORTTPL_HASFIELD6( SORTTPL_RADIXPERMUTE(SORTTPL_FIELD6TYPE, field6) )
+
+   BMSfreeMemoryNull(&fieldbuffer);
+   BMSfreeMemoryArray(&permbuffer);
+   BMSfreeMemoryArray(&perm);
+   BMSfreeMemoryArray(&ukeysbuffer);
+   BMSfreeMemoryArray(&ukeys);
+
+   return TRUE;
+}
+#endif
+
 /** SCIPsort...(): sorts array 'key' and performs the same permutations on the additional 'field' arrays */
 void SORTTPL_NAME(SCIPsort, SORTTPL_NAMEEXT)
 (
@@ -601,6 +748,21 @@ void SORTTPL_NAME(SCIPsort, SORTTPL_NAMEEXT)
             SORTTPL_HASINDCOMPPAR(dataptr)
             0, len-1);
    }
+#ifdef SORTTPL_RADIXSORT
+   /* use radix sort on large lists if the auxiliary memory is available */
+   else if( len >= SORTTPL_RADIXSORTMIN && SORTTPL_NAME(sorttpl_radixSort, SORTTPL_NAMEEXT)
+      (key,
+         SORTTPL_HASFIELD1PAR(field1)
+         SORTTPL_HASFIELD2PAR(field2)
+         SORTTPL_HASFIELD3PAR(field3)
+         SORTTPL_HASFIELD4PAR(field4)
+         SORTTPL_HASFIELD5PAR(field5)
+         SORTTPL_HASFIELD6PAR(field6)
+         len) )
+   {
+      /* array is sorted */
+   }
+#endif
    else
    {
       SORTTPL_NAME(sorttpl_qSort, SORTTPL_NAMEEXT)
@@ -1149,4 +1311,7 @@ void SORTTPL_NAME(SCIPselect, SORTTPL_NAMEEXT)
 #undef SORTTPL_SWAP
 #undef SORTTPL_SHELLSORTMAX
 #undef SORTTPL_MINSIZENINTHER
+#undef SORTTPL_RADIXSORTMIN
+#undef SORTTPL_RADIXPERMUTE
+#undef SORTTPL_RADIXSORT
 #undef SORTTPL_BACKWARDS
@@ -262,6 +262,8 @@ struct SCIP_RandNumGen
    uint32_t              xor_seed;           /**< Xorshift seed */
    uint32_t              mwc_seed;           /**< Multiply-with-carry seed */
    uint32_t              cst_seed;           /**< constant seed */
+   uint64_t              xoshiro[4];         /**< state of the xoshiro256++ generator */
+   SCIP_Bool             usexoshiro;         /**< should xoshiro256++ be used instead of KISS? */
 };
 
 /** disjoint set (disjoint set (union find)) data structure for querying and updating connectedness in a graph with integer vertices 0,...,n - 1 */
@@ -412,6 +412,8 @@ struct SCIP_Set
    int                   random_randomseed;     /**< random seed for LP solver, e.g. for perturbations in the simplex (0: LP default) */
    SCIP_Bool             random_permuteconss;   /**< should order of constraints be permuted (depends on permutationseed)? */
    SCIP_Bool             random_permutevars;    /**< should order of variables be permuted (depends on permutationseed)? */
+   SCIP_Bool             random_usexoshiro;     /**< should the random number generators of the plugins use xoshiro256++
+                                                 *   instead of KISS? */
 
    /* node selection settings */
    char                  nodesel_childsel;   /**< child selection rule ('d'own, 'u'p, 'p'seudo costs, 'i'nference, 'l'p value,
@@ -565,8 +567,10 @@ struct SCIP_Set
    /* concurrent solver settings */
    SCIP_Bool             concurrent_changeseeds;    /**< change the seeds in the different solvers? */
    SCIP_Bool             concurrent_changechildsel; /**< change the child selection rule in different solvers? */
+   SCIP_Bool             concurrent_changenodesel;  /**< change the node selection rule in different solvers? */
    SCIP_Bool             concurrent_commvarbnds;    /**< should the concurrent solvers communicate global variable bound changes? */
    SCIP_Bool             concurrent_presolvebefore; /**< should the problem be presolved before it is copied to the concurrent solvers? */
+   SCIP_Real             concurrent_chunkpoolsize;  /**< maximal memory in MB of the chunk pool shared by the concurrent solvers */
    int                   concurrent_initseed;       /**< the seed for computing the concurrent solver seeds */
    SCIP_Real             concurrent_freqinit;       /**< initial frequency of synchronization */
    SCIP_Real             concurrent_freqmax;        /**< maximal frequency of synchronization */
@@ -574,6 +578,8 @@ struct SCIP_Set
    SCIP_Real             concurrent_targetprogress; /**< when adapting the synchronization frequency this value is the targeted
                                                      *   relative difference by which the absolute gap decreases per synchronization */
    int                   concurrent_maxnsols;       /**< maximum number of solutions that will get stored in one synchronization */
+   SCIP_Bool             concurrent_asyncsols;      /**< should improving solutions be shared immediately instead of at the next
+                                                     *   synchronization (only in opportunistic mode)? */
    int                   concurrent_nbestsols;      /**< number of best solutions that should be considered for synchronization */
    int                   concurrent_maxnsyncdelay;  /**< max number of synchronizations before data is used */
    SCIP_Real             concurrent_minsyncdelay;   /**< min offset before synchronization data is used */
@@ -62,6 +62,14 @@ struct SCIP_SyncStore
    SCIP_Real             syncfreqmax;        /**< the maximum synchronization frequency */
    int                   maxnsols;           /**< maximum number of solutions that can be shared in one synchronization */
    int                   nsolvers;           /**< number of solvers synchronizing with this syncstore */
+
+   /* solution slot for sharing improving solutions between the synchronizations */
+   SCIP_Bool             asyncsols;          /**< are improving solutions shared immediately through the solution slot? */
+   SCIP_LOCK             asynclock;          /**< lock to protect the solution slot */
+   SCIP_Real*            asyncsolvals;       /**< values of the solution in the solution slot, or NULL if not used */
+   SCIP_Real             asyncsolobj;        /**< objective value of the solution in the solution slot */
+   int                   asyncsolsource;     /**< the solverid of the solver that published the solution in the slot */
+   SCIP_Longint          asyncsolnum;        /**< number of solutions that have been published in the solution slot */
 };
 
 
@@ -194,9 +194,15 @@ struct SCIP_Negate
    SCIP_Real             constant;           /**< constant shift c in negation */
 };
 
-/** variable of the problem */
+/** variable of the problem
+ *
+ *  The local and global domains and the objective coefficient are the first members, such that the bounds read by
+ *  propagators and checkers share the first cache line of the variable.
+ */
 struct SCIP_Var
 {
+   SCIP_DOM              locdom;             /**< domain of variable in current subproblem */
+   SCIP_DOM              glbdom;             /**< domain of variable in global problem */
    SCIP_Real             obj;                /**< objective function value of variable (might be changed temporarily in probing mode)*/
    SCIP_Real             unchangedobj;       /**< unchanged objective function value of variable (ignoring temporary changes in probing mode) */
    SCIP_Real             branchfactor;       /**< factor to weigh variable's branching score with */
@@ -213,8 +219,6 @@ struct SCIP_Var
    SCIP_Real             conflictrelaxedub;  /**< minimal release upper bound of variable in the current conflict (conflictrelqxlb <= conflictlb) */
    SCIP_Real             lazylb;             /**< global lower bound that is ensured by constraints and has not to be added to the LP */
    SCIP_Real             lazyub;             /**< global upper bound that is ensured by constraints and has not to be added to the LP */
-   SCIP_DOM              glbdom;             /**< domain of variable in global problem */
-   SCIP_DOM              locdom;             /**< domain of variable in current subproblem */
    union
    {
       SCIP_ORIGINAL      original;           /**< original variable information */
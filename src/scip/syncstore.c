@@ -69,7 +69,10 @@ SCIP_RETCODE SCIPsyncstoreCreate(
    (*syncstore)->syncdata = NULL;
    (*syncstore)->stopped = FALSE;
    (*syncstore)->nuses = 1;
+   (*syncstore)->asyncsols = FALSE;
+   (*syncstore)->asyncsolvals = NULL;
    SCIP_CALL( SCIPtpiInitLock(&(*syncstore)->lock) );
+   SCIP_CALL( SCIPtpiInitLock(&(*syncstore)->asynclock) );
 
    return SCIP_OKAY;
 }
@@ -98,6 +101,7 @@ SCIP_RETCODE SCIPsyncstoreRelease(
       }
 
       assert(!(*syncstore)->initialized);
+      SCIPtpiDestroyLock(&(*syncstore)->asynclock);
       SCIPtpiDestroyLock(&(*syncstore)->lock);
       BMSfreeMemory(syncstore);
    }
@@ -172,6 +176,18 @@ SCIP_RETCODE SCIPsyncstoreInit(
    SCIP_CALL( SCIPgetIntParam(scip, "parallel/mode", &paramode) );
    syncstore->mode = (SCIP_PARALLELMODE) paramode;
 
+   /* the solution slot is read at arbitrary points in time, so it can only be used in opportunistic mode */
+   SCIP_CALL( SCIPgetBoolParam(scip, "concurrent/sync/asyncsols", &syncstore->asyncsols) );
+   syncstore->asyncsols = syncstore->asyncsols && syncstore->mode == SCIP_PARA_OPPORTUNISTIC;
+   syncstore->asyncsolobj = SCIPinfinity(scip);
+   syncstore->asyncsolsource = -1;
+   syncstore->asyncsolnum = 0;
+
+   if( syncstore->asyncsols )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(syncstore->mainscip, &syncstore->asyncsolvals, syncstore->ninitvars) );
+   }
+
    SCIP_CALL( SCIPtpiInit(syncstore->nsolvers, INT_MAX, FALSE) );
    SCIP_CALL( SCIPautoselectDisps(scip) );
 
@@ -217,6 +233,7 @@ SCIP_RETCODE SCIPsyncstoreExit(
    }
 
    SCIPfreeBlockMemoryArray(syncstore->mainscip, &syncstore->syncdata, syncstore->nsyncdata);
+   SCIPfreeBlockMemoryArrayNull(syncstore->mainscip, &syncstore->asyncsolvals, syncstore->ninitvars);
 
    syncstore->initialized = FALSE;
    syncstore->stopped = FALSE;
@@ -790,3 +807,94 @@ SCIP_PARALLELMODE SCIPsyncstoreGetMode(
 
    return syncstore->mode;
 }
+
+/** returns whether improving solutions are shared immediately through the solution slot of the synchronization store */
+SCIP_Bool SCIPsyncstoreUsesAsyncSols(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   )
+{
+   assert(syncstore != NULL);
+
+   return syncstore->initialized && syncstore->asyncsols;
+}
+
+/** publishes a solution in the solution slot of the synchronization store if it is better than the solution in the
+ *  slot; the solution values are copied while the slot is locked
+ */
+SCIP_RETCODE SCIPsyncstorePublishSol(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_Real             solobj,             /**< the objective value of the solution */
+   int                   ownerid,            /**< an identifier for the owner of the solution, e.g. the thread number */
+   SCIP_Real*            solvals,            /**< the solution values in the order of the main SCIP's variables */
+   int                   nsolvals,           /**< number of solution values, must be the number of variables of the
+                                              *   synchronization store */
+   SCIP_Bool*            published           /**< pointer to store whether the solution was published, or NULL */
+   )
+{
+   assert(syncstore != NULL);
+   assert(SCIPsyncstoreUsesAsyncSols(syncstore));
+   assert(solvals != NULL);
+   assert(nsolvals == syncstore->ninitvars);
+
+   if( published != NULL )
+      *published = FALSE;
+
+   SCIP_CALL( SCIPtpiAcquireLock(&syncstore->asynclock) );
+
+   if( solobj < syncstore->asyncsolobj )
+   {
+      syncstore->asyncsolobj = solobj;
+      syncstore->asyncsolsource = ownerid;
+      BMScopyMemoryArray(syncstore->asyncsolvals, solvals, nsolvals);
+      ++syncstore->asyncsolnum;
+
+      if( published != NULL )
+         *published = TRUE;
+   }
+
+   SCIP_CALL( SCIPtpiReleaseLock(&syncstore->asynclock) );
+
+   return SCIP_OKAY;
+}
+
+/** copies the solution of the solution slot of the synchronization store into the given array if it was published
+ *  after the last read of the caller, by a different owner, and its objective value is smaller than the given bound
+ */
+SCIP_RETCODE SCIPsyncstoreReadPublishedSol(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   ownerid,            /**< identifier of the reader; own solutions are not returned */
+   SCIP_Real             bound,              /**< only solutions with a smaller objective value are returned */
+   SCIP_Longint*         lastsolnum,         /**< pointer to the number of the last solution read by the caller,
+                                              *   which is updated */
+   SCIP_Real*            solvals,            /**< array to store the solution values */
+   SCIP_Real*            solobj,             /**< pointer to store the objective value of the solution */
+   SCIP_Bool*            found               /**< pointer to store whether a solution was copied */
+   )
+{
+   assert(syncstore != NULL);
+   assert(SCIPsyncstoreUsesAsyncSols(syncstore));
+   assert(lastsolnum != NULL);
+   assert(solvals != NULL);
+   assert(solobj != NULL);
+   assert(found != NULL);
+
+   *found = FALSE;
+
+   SCIP_CALL( SCIPtpiAcquireLock(&syncstore->asynclock) );
+
+   if( syncstore->asyncsolnum > *lastsolnum )
+   {
+      *lastsolnum = syncstore->asyncsolnum;
+
+      if( syncstore->asyncsolsource != ownerid && syncstore->asyncsolobj < bound )
+      {
+         BMScopyMemoryArray(solvals, syncstore->asyncsolvals, syncstore->ninitvars);
+         *solobj = syncstore->asyncsolobj;
+         *found = TRUE;
+      }
+   }
+
+   SCIP_CALL( SCIPtpiReleaseLock(&syncstore->asynclock) );
+
+   return SCIP_OKAY;
+}
@@ -291,4 +291,39 @@ SCIP_PARALLELMODE SCIPsyncstoreGetMode(
    SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
    );
 
+/** returns whether improving solutions are shared immediately through the solution slot of the synchronization store */
+SCIP_EXPORT
+SCIP_Bool SCIPsyncstoreUsesAsyncSols(
+   SCIP_SYNCSTORE*       syncstore           /**< the synchronization store */
+   );
+
+/** publishes a solution in the solution slot of the synchronization store if it is better than the solution in the
+ *  slot; the solution values are copied while the slot is locked
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstorePublishSol(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   SCIP_Real             solobj,             /**< the objective value of the solution */
+   int                   ownerid,            /**< an identifier for the owner of the solution, e.g. the thread number */
+   SCIP_Real*            solvals,            /**< the solution values in the order of the main SCIP's variables */
+   int                   nsolvals,           /**< number of solution values, must be the number of variables of the
+                                              *   synchronization store */
+   SCIP_Bool*            published           /**< pointer to store whether the solution was published, or NULL */
+   );
+
+/** copies the solution of the solution slot of the synchronization store into the given array if it was published
+ *  after the last read of the caller, by a different owner, and its objective value is smaller than the given bound
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsyncstoreReadPublishedSol(
+   SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
+   int                   ownerid,            /**< identifier of the reader; own solutions are not returned */
+   SCIP_Real             bound,              /**< only solutions with a smaller objective value are returned */
+   SCIP_Longint*         lastsolnum,         /**< pointer to the number of the last solution read by the caller,
+                                              *   which is updated */
+   SCIP_Real*            solvals,            /**< array to store the solution values */
+   SCIP_Real*            solobj,             /**< pointer to store the objective value of the solution */
+   SCIP_Bool*            found               /**< pointer to store whether a solution was copied */
+   );
+
 #endif
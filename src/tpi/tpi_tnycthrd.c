@@ -34,6 +34,7 @@ struct SCIP_Job
 {
    int                   jobid;              /**< id to identify jobs from a common process */
    struct                SCIP_Job* nextjob;  /**< pointer to the next job in the queue */
+   struct                SCIP_Job* prevjob;  /**< pointer to the previous job in the queue */
    SCIP_RETCODE          (*jobfunc)(void* args);/**< pointer to the job function */
    void*                 args;               /**< pointer to the function arguments */
    SCIP_RETCODE          retcode;            /**< return code of the job */
@@ -48,6 +49,28 @@ struct SCIP_JobQueue
 };
 typedef struct SCIP_JobQueue SCIP_JOBQUEUE;
 
+/** the job deque of a single worker thread
+ *
+ *  The owning thread takes jobs from the back of its deque, idle threads steal jobs from the front of the deques of
+ *  the other threads. Each deque has its own lock, such that threads only compete for the pool lock when they go to
+ *  sleep or report a finished job.
+ */
+struct SCIP_LocalQueue
+{
+   SCIP_JOBQUEUE         jobs;               /**< the jobs in the deque */
+   SCIP_LOCK             lock;               /**< lock to protect the deque */
+};
+typedef struct SCIP_LocalQueue SCIP_LOCALQUEUE;
+
+/** the number of unfinished jobs that were submitted with a common job id */
+struct SCIP_JobGroup
+{
+   int                   jobid;              /**< the job id of the group */
+   int                   nunfinished;        /**< number of submitted jobs of this group that did not finish yet */
+   struct                SCIP_JobGroup* next;/**< pointer to the next job group */
+};
+typedef struct SCIP_JobGroup SCIP_JOBGROUP;
+
 /** The thread pool */
 struct SCIP_ThreadPool
 {
@@ -57,9 +80,13 @@ struct SCIP_ThreadPool
 
    /* Current pool state */
    thrd_t*               threads;            /**< the threads included in the pool */
-   SCIP_JOBQUEUE*        jobqueue;           /**< the job queue */
-   SCIP_JOBQUEUE*        currentjobs;        /**< the jobs currently being processed on a thread;
-                                              *   only a single job is allowed per thread. */
+   SCIP_LOCALQUEUE*      localqueues;        /**< array with a job deque for each thread */
+   int                   nextqueue;          /**< deque that receives the next job submitted from outside the pool */
+   int                   nqueuedjobs;        /**< number of submitted jobs that are waiting in a deque or running;
+                                              *   protected by the pool lock */
+   unsigned int          nsubmissions;       /**< number of submitted jobs, used by idle threads to detect submissions
+                                              *   since their last look at the deques; protected by the pool lock */
+   SCIP_JOBGROUP*        jobgroups;          /**< list with the number of unfinished jobs for each job id */
    SCIP_JOBQUEUE*        finishedjobs;       /**< finished jobs that are not yet collected */
    int                   currworkingthreads; /**< the threads currently processing jobs */
    SCIP_Bool             blockwhenfull;      /**< indicates that the queue can only be as large as nthreads */
@@ -77,6 +104,135 @@ struct SCIP_ThreadPool
    SCIP_CONDITION        jobfinished;        /**< condition to broadcast that a job has been finished */
 };
 
+/** removes a job from the front or the back of a deque; the lock of the deque must be held by the caller */
+static
+SCIP_JOB* localQueueRemoveJob(
+   SCIP_JOBQUEUE*        jobs,               /**< jobs of the deque */
+   SCIP_Bool             fromback            /**< should the newest job be removed instead of the oldest one? */
+   )
+{
+   SCIP_JOB* job;
+
+   if( jobs->njobs == 0 )
+      return NULL;
+
+   if( fromback )
+   {
+      job = jobs->lastjob;
+      jobs->lastjob = job->prevjob;
+
+      if( jobs->lastjob != NULL )
+         jobs->lastjob->nextjob = NULL;
+      else
+         jobs->firstjob = NULL;
+   }
+   else
+   {
+      job = jobs->firstjob;
+      jobs->firstjob = job->nextjob;
+
+      if( jobs->firstjob != NULL )
+         jobs->firstjob->prevjob = NULL;
+      else
+         jobs->lastjob = NULL;
+   }
+
+   --jobs->njobs;
+
+   job->nextjob = NULL;
+   job->prevjob = NULL;
+
+   return job;
+}
+
+/** gets the next job for the given thread
+ *
+ *  The job is taken from the back of the thread's own deque. If this is empty, a job is stolen from the front of the
+ *  deque of another thread.
+ */
+static
+SCIP_RETCODE threadPoolGetJob(
+   SCIP_THREADPOOL*      threadpool,         /**< thread pool */
+   int                   threadnum,          /**< number of the thread that asks for a job */
+   SCIP_JOB**            job                 /**< pointer to store the job, or NULL if all deques are empty */
+   )
+{
+   int i;
+
+   assert(threadpool != NULL);
+   assert(threadnum >= 0 && threadnum < threadpool->nthreads);
+   assert(job != NULL);
+
+   SCIP_CALL( SCIPtpiAcquireLock(&threadpool->localqueues[threadnum].lock) );
+   *job = localQueueRemoveJob(&threadpool->localqueues[threadnum].jobs, TRUE);
+   SCIP_CALL( SCIPtpiReleaseLock(&threadpool->localqueues[threadnum].lock) );
+
+   /* try to steal a job from the other threads, starting with the next thread */
+   for( i = 1; i < threadpool->nthreads && *job == NULL; ++i )
+   {
+      SCIP_LOCALQUEUE* victim;
+
+      victim = &threadpool->localqueues[(threadnum + i) % threadpool->nthreads];
+
+      SCIP_CALL( SCIPtpiAcquireLock(&victim->lock) );
+      *job = localQueueRemoveJob(&victim->jobs, FALSE);
+      SCIP_CALL( SCIPtpiReleaseLock(&victim->lock) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the job group of the given job id, or NULL if no job with this id is unfinished or uncollected;
+ *  the pool lock must be held by the caller
+ */
+static
+SCIP_JOBGROUP* threadPoolFindJobGroup(
+   SCIP_THREADPOOL*      threadpool,         /**< thread pool */
+   int                   jobid               /**< the job id */
+   )
+{
+   SCIP_JOBGROUP* jobgroup;
+
+   for( jobgroup = threadpool->jobgroups; jobgroup != NULL; jobgroup = jobgroup->next )
+   {
+      if( jobgroup->jobid == jobid )
+         return jobgroup;
+   }
+
+   return NULL;
+}
+
+/** appends a job to the list of finished jobs and updates its job group; the pool lock must be held by the caller */
+static
+void threadPoolFinishJob(
+   SCIP_THREADPOOL*      threadpool,         /**< thread pool */
+   SCIP_JOB*             job                 /**< the finished job */
+   )
+{
+   SCIP_JOBGROUP* jobgroup;
+
+   job->nextjob = NULL;
+
+   if( threadpool->finishedjobs->njobs == 0 )
+   {
+      threadpool->finishedjobs->firstjob = job;
+      threadpool->finishedjobs->lastjob = job;
+   }
+   else
+   {
+      threadpool->finishedjobs->lastjob->nextjob = job;
+      threadpool->finishedjobs->lastjob = job;
+   }
+
+   threadpool->finishedjobs->njobs++;
+
+   jobgroup = threadPoolFindJobGroup(threadpool, job->jobid);
+   assert(jobgroup != NULL);
+   assert(jobgroup->nunfinished > 0);
+
+   jobgroup->nunfinished--;
+}
+
 /** this function controls the execution of each of the threads */
 static
 SCIP_RETCODE threadPoolThreadRetcode(
@@ -84,122 +240,83 @@ SCIP_RETCODE threadPoolThreadRetcode(
    )
 {
    SCIP_JOB* newjob;
-   SCIP_JOB* prevjob;
-   SCIP_JOB* currjob;
+   unsigned int nsubmissions;
 
    _threadnumber = (int)(uintptr_t) threadnum;
 
    /* Increase the number of active threads */
    SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
    _threadpool->currworkingthreads += 1;
+   nsubmissions = _threadpool->nsubmissions;
    SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
-   /* this is an endless loop that runs until the thrd_exit function is called */
+   /* this is an endless loop that runs until the thrd_exit function is called; a job is taken from the deques without
+    * the pool lock, which is only acquired to report a finished job or to go to sleep
+    */
    while( TRUE ) /*lint !e716*/
    {
-      SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
+      /* getting the next job from the own deque or from another thread */
+      SCIP_CALL( threadPoolGetJob(_threadpool, _threadnumber, &newjob) );
 
-      /* the queue is empty but the shutdown command has not been given */
-      while( _threadpool->jobqueue->njobs == 0 && !_threadpool->shutdown )
+      if( newjob == NULL )
       {
-         SCIP_CALL( SCIPtpiWaitCondition(&(_threadpool->queuenotempty), &(_threadpool->poollock)) );
-      }
-
-      /* if the shutdown command has been given, then exit the thread */
-      if( _threadpool->shutdown )
-      {
-         /* Decrease the thread count when execution of job queue has completed */
-         _threadpool->currworkingthreads -= 1;
-         SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
+         SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
-         thrd_exit((int)SCIP_OKAY);
-      }
+         /* all deques were empty when they were checked; jobs are only submitted while the pool lock is held, so every
+          * job that was submitted before nsubmissions was recorded has been visible in the deques, and it is safe to
+          * sleep until another job is submitted or the shutdown command is given
+          */
+         while( _threadpool->nsubmissions == nsubmissions && !_threadpool->shutdown )
+         {
+            SCIP_CALL( SCIPtpiWaitCondition(&(_threadpool->queuenotempty), &(_threadpool->poollock)) );
+         }
 
-      /* getting the next job in the queue */
-      newjob = _threadpool->jobqueue->firstjob;
-      _threadpool->jobqueue->njobs--;            /* decreasing the number of jobs in the queue */
+         /* if the shutdown command has been given, then exit the thread */
+         if( _threadpool->shutdown )
+         {
+            /* Decrease the thread count when execution of job queue has completed */
+            _threadpool->currworkingthreads -= 1;
+            SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         _threadpool->jobqueue->firstjob = NULL;
-         _threadpool->jobqueue->lastjob = NULL;
-      }
-      else
-         _threadpool->jobqueue->firstjob = newjob->nextjob;     /* updating the queue */
+            thrd_exit((int)SCIP_OKAY);
+         }
 
-      /* if we want to wait when the queue is full, then we broadcast that the queue can now take new jobs */
-      if( _threadpool->blockwhenfull &&
-          _threadpool->jobqueue->njobs == _threadpool->queuesize - 1 )
-      {
-         SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->queuenotfull)) );
-      }
+         nsubmissions = _threadpool->nsubmissions;
 
-      /* indicating that the queue is empty */
-      if( _threadpool->jobqueue->njobs == 0 )
-      {
-         SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->queueempty)) );
-      }
+         SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
-      /* updating the current job list */
-      if( _threadpool->currentjobs->njobs == 0 )
-      {
-         _threadpool->currentjobs->firstjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
+         continue;
       }
-      else
-      {
-         _threadpool->currentjobs->lastjob->nextjob = newjob;
-         _threadpool->currentjobs->lastjob = newjob;
-      }
-
-      _threadpool->currentjobs->njobs++;
-
-      SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
       /* setting the job to run on this thread */
       newjob->retcode = (*(newjob->jobfunc))(newjob->args);
 
-      /* setting the current job on this thread to NULL */
       SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
-      /* finding the location of the processed job in the currentjobs queue */
-      currjob = _threadpool->currentjobs->firstjob;
-      prevjob = NULL;
-
-      while( currjob != newjob )
-      {
-         prevjob = currjob;
-         currjob = prevjob->nextjob;
-      }
-
-      /* removing the processed job from current jobs list */
-      if( currjob == _threadpool->currentjobs->firstjob )
-         _threadpool->currentjobs->firstjob = currjob->nextjob;
-      else
-         prevjob->nextjob = currjob->nextjob; /*lint !e794*/
-
-      if( currjob == _threadpool->currentjobs->lastjob )
-         _threadpool->currentjobs->lastjob = prevjob;
+      /* updating the finished job list */
+      threadPoolFinishJob(_threadpool, newjob);
 
-      _threadpool->currentjobs->njobs--;
+      /* the job does not count towards the size of the queue anymore */
+      assert(_threadpool->nqueuedjobs > 0);
+      _threadpool->nqueuedjobs--;
 
-      /* updating the finished job list */
-      if( _threadpool->finishedjobs->njobs == 0 )
+      /* broadcast that the queue can take new jobs again if it was full */
+      if( _threadpool->nqueuedjobs == _threadpool->queuesize - 1 )
       {
-         _threadpool->finishedjobs->firstjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
+         SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->queuenotfull)) );
       }
-      else
+
+      /* indicating that the queue is empty */
+      if( _threadpool->nqueuedjobs == 0 )
       {
-         _threadpool->finishedjobs->lastjob->nextjob = newjob;
-         _threadpool->finishedjobs->lastjob = newjob;
+         SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool->queueempty)) );
       }
 
-      _threadpool->finishedjobs->njobs++;
-
       /* signalling that a job has been finished */
       SCIP_CALL( SCIPtpiBroadcastCondition(&(_threadpool)->jobfinished) );
 
+      nsubmissions = _threadpool->nsubmissions;
+
       SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
    }
 }
@@ -235,18 +352,20 @@ SCIP_RETCODE createThreadPool(
    (*thrdpool)->blockwhenfull = blockwhenfull;
    (*thrdpool)->shutdown = FALSE;
    (*thrdpool)->queueopen = TRUE;
+   (*thrdpool)->nextqueue = 0;
+   (*thrdpool)->nqueuedjobs = 0;
+   (*thrdpool)->nsubmissions = 0;
+   (*thrdpool)->jobgroups = NULL;
 
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->jobqueue) );
-   (*thrdpool)->jobqueue->firstjob = NULL;
-   (*thrdpool)->jobqueue->lastjob = NULL;
-   (*thrdpool)->jobqueue->njobs = 0;
-
-   /* allocating memory for the job queue */
-   SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->currentjobs) );
-   (*thrdpool)->currentjobs->firstjob = NULL;
-   (*thrdpool)->currentjobs->lastjob = NULL;
-   (*thrdpool)->currentjobs->njobs = 0;
+   /* allocating memory for the job deques of the threads */
+   SCIP_ALLOC( BMSallocMemoryArray(&(*thrdpool)->localqueues, nthreads) );
+   for( i = 0; i < (unsigned)nthreads; i++ )
+   {
+      (*thrdpool)->localqueues[i].jobs.firstjob = NULL;
+      (*thrdpool)->localqueues[i].jobs.lastjob = NULL;
+      (*thrdpool)->localqueues[i].jobs.njobs = 0;
+      SCIP_CALL( SCIPtpiInitLock(&(*thrdpool)->localqueues[i].lock) ); /*lint !e2482*/
+   }
 
    /* allocating memory for the job queue */
    SCIP_ALLOC( BMSallocMemory(&(*thrdpool)->finishedjobs) );
@@ -287,38 +406,67 @@ SCIP_RETCODE createThreadPool(
 
 /** adding a job to the job queue.
  *
- *  This gives some more flexibility in the handling of new jobs.
+ *  Jobs that are submitted by a worker thread are added to the back of its own deque, jobs that are submitted from
+ *  outside the pool are distributed round-robin over the deques of all threads.
  *  This function needs to be called from within a mutex.
  */
 static
-void jobQueueAddJob(
+SCIP_RETCODE jobQueueAddJob(
    SCIP_THREADPOOL*      threadpool,           /**< pointer to store threadpool */
    SCIP_JOB*             newjob                /**< pointer to new job */
    )
 {
-   /* @todo we want to work out what to do with a full job queue. Is there a problem if the limit is hit? */
-   /* @note it is important to have a queuesize. This will stop the code submitting infinitely many jobs. */
-   assert(threadpool->jobqueue->njobs < threadpool->queuesize);
+   SCIP_LOCALQUEUE* localqueue;
+   SCIP_JOBGROUP* jobgroup;
+   int queueidx;
 
-   newjob->nextjob = NULL;
+   assert(threadpool->nthreads > 0);
 
-   /* checking the status of the job queue */
-   if( threadpool->jobqueue->njobs == 0 )
+   /* updating the number of unfinished jobs of the job group */
+   jobgroup = threadPoolFindJobGroup(threadpool, newjob->jobid);
+   if( jobgroup == NULL )
    {
-      threadpool->jobqueue->firstjob = newjob;
-      threadpool->jobqueue->lastjob = newjob;
+      SCIP_ALLOC( BMSallocMemory(&jobgroup) );
+      jobgroup->jobid = newjob->jobid;
+      jobgroup->nunfinished = 0;
+      jobgroup->next = threadpool->jobgroups;
+      threadpool->jobgroups = jobgroup;
    }
-   else /* it is assumed that the jobqueue is not full */
+   jobgroup->nunfinished++;
+
+   if( _threadnumber >= 0 && _threadnumber < threadpool->nthreads )
+      queueidx = _threadnumber;
+   else
    {
-      threadpool->jobqueue->lastjob->nextjob = newjob;
-      threadpool->jobqueue->lastjob = newjob;
+      queueidx = threadpool->nextqueue;
+      threadpool->nextqueue = (threadpool->nextqueue + 1) % threadpool->nthreads;
    }
 
+   localqueue = &threadpool->localqueues[queueidx];
+
+   newjob->nextjob = NULL;
+
+   SCIP_CALL( SCIPtpiAcquireLock(&localqueue->lock) );
+
+   /* checking the status of the job deque */
+   newjob->prevjob = localqueue->jobs.lastjob;
+   if( localqueue->jobs.njobs == 0 )
+      localqueue->jobs.firstjob = newjob;
+   else
+      localqueue->jobs.lastjob->nextjob = newjob;
+   localqueue->jobs.lastjob = newjob;
+   localqueue->jobs.njobs++;
+
+   SCIP_CALL( SCIPtpiReleaseLock(&localqueue->lock) );
+
+   threadpool->nqueuedjobs++;
+   threadpool->nsubmissions++;
+
    /* signalling to all threads that the queue has jobs using the signal instead of broadcast because only one thread
     * should be awakened */
-   SCIP_CALL_ABORT( SCIPtpiSignalCondition(&(threadpool->queuenotempty)) );
+   SCIP_CALL( SCIPtpiSignalCondition(&(threadpool->queuenotempty)) );
 
-   threadpool->jobqueue->njobs++;
+   return SCIP_OKAY;
 }
 
 /** adds a job to the threadpool */
@@ -334,7 +482,7 @@ SCIP_RETCODE threadPoolAddWork(
    SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
    /* if the queue is full and we are blocking, then return an error. */
-   if( _threadpool->jobqueue->njobs == _threadpool->queuesize && _threadpool->blockwhenfull )
+   if( _threadpool->nqueuedjobs >= _threadpool->queuesize && _threadpool->blockwhenfull )
    {
       SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
       *status = SCIP_SUBMIT_QUEUEFULL;
@@ -344,7 +492,8 @@ SCIP_RETCODE threadPoolAddWork(
    /* Wait until the job queue is not full. If the queue is closed or the thread pool is shut down, then stop waiting. */
    /* @todo this needs to be checked. It is possible that a job can be submitted and then the queue is closed or the
     * thread pool is shut down. Need to work out the best way to handle this. */
-   while( _threadpool->jobqueue->njobs == _threadpool->queuesize && !(_threadpool->shutdown || !_threadpool->queueopen) )
+   while( _threadpool->nqueuedjobs >= _threadpool->queuesize
+      && !(_threadpool->shutdown || !_threadpool->queueopen) )
    {
       SCIP_CALL( SCIPtpiWaitCondition(&(_threadpool->queuenotfull), &(_threadpool->poollock)) );
    }
@@ -363,13 +512,10 @@ SCIP_RETCODE threadPoolAddWork(
       return SCIP_OKAY;
    }
 
-   /* creating the job for submission */
-   newjob->nextjob = NULL;
-
    /* adding the job to the queue */
    /* this can only happen if the queue is not full */
-   assert(_threadpool->jobqueue->njobs != _threadpool->queuesize);
-   jobQueueAddJob(_threadpool, newjob);
+   assert(_threadpool->nqueuedjobs < _threadpool->queuesize);
+   SCIP_CALL( jobQueueAddJob(_threadpool, newjob) );
 
    SCIP_CALL( SCIPtpiReleaseLock(&(_threadpool->poollock)) );
 
@@ -378,29 +524,42 @@ SCIP_RETCODE threadPoolAddWork(
    return SCIP_OKAY;
 }
 
-/** frees the jobqueue of the threadpool */
+/** frees the job deques of the threadpool */
 static
 void freeJobQueue(
    SCIP_THREADPOOL*      thrdpool            /**< pointer to thread pool */
    )
 {
    SCIP_JOB* currjob;
+   int i;
 
    assert(!thrdpool->queueopen);
    assert(thrdpool->shutdown);
 
    /* iterating through all jobs until all have been freed */
-   while( thrdpool->jobqueue->firstjob != NULL )
+   for( i = 0; i < thrdpool->nthreads; ++i )
    {
-      currjob = thrdpool->jobqueue->firstjob->nextjob;
-      thrdpool->jobqueue->firstjob = thrdpool->jobqueue->firstjob->nextjob;
-      BMSfreeMemory(&currjob);
+      while( (currjob = localQueueRemoveJob(&thrdpool->localqueues[i].jobs, FALSE)) != NULL )
+      {
+         BMSfreeMemory(&currjob);
+      }
+
+      assert(thrdpool->localqueues[i].jobs.firstjob == NULL);
+      assert(thrdpool->localqueues[i].jobs.lastjob == NULL);
+
+      SCIPtpiDestroyLock(&thrdpool->localqueues[i].lock);
    }
 
-   assert(thrdpool->jobqueue->firstjob == NULL);
-   assert(thrdpool->jobqueue->lastjob == NULL);
+   BMSfreeMemoryArray(&thrdpool->localqueues);
 
-   BMSfreeMemory(&thrdpool->jobqueue);
+   /* freeing the job groups of jobs that were never collected */
+   while( thrdpool->jobgroups != NULL )
+   {
+      SCIP_JOBGROUP* jobgroup = thrdpool->jobgroups;
+
+      thrdpool->jobgroups = jobgroup->next;
+      BMSfreeMemory(&jobgroup);
+   }
 }
 
 /** free the thread pool */
@@ -433,7 +592,7 @@ SCIP_RETCODE freeThreadPool(
    /* if the jobs in the queue should be completed, then we wait until the queueempty condition is set */
    if( completequeue )
    {
-      while( (*thrdpool)->jobqueue->njobs > 0 )
+      while( (*thrdpool)->nqueuedjobs > 0 )
       {
          SCIP_CALL( SCIPtpiWaitCondition(&((*thrdpool)->queueempty), &((*thrdpool)->poollock)) );
       }
@@ -466,9 +625,7 @@ SCIP_RETCODE freeThreadPool(
    /* freeing memory and data structures */
    BMSfreeMemoryArray(&(*thrdpool)->threads);
 
-   /* Freeing the current jobs list. This assumes that all jobs complete before the tpi is closed. */
-   assert((*thrdpool)->currentjobs->njobs == 0);
-   BMSfreeMemory(&(*thrdpool)->currentjobs);
+   /* Freeing the finished jobs list. This assumes that all jobs are collected before the tpi is closed. */
    assert((*thrdpool)->finishedjobs->njobs == 0);
    BMSfreeMemory(&(*thrdpool)->finishedjobs);
 
@@ -488,47 +645,6 @@ SCIP_RETCODE freeThreadPool(
    return retcode;
 }
 
-
-/* checking a job queue */
-static
-SCIP_JOBSTATUS checkJobQueue(
-   SCIP_JOBQUEUE*        jobqueue,           /**< pointer to the job queue */
-   int                   jobid               /**< id of job to check */
-   )
-{
-   SCIP_JOB* currjob = jobqueue->firstjob;
-
-   /* checking the job ids */
-   if( currjob != NULL )
-   {
-      while( currjob != jobqueue->lastjob )
-      {
-         if( currjob->jobid == jobid )
-            return SCIP_JOB_INQUEUE;
-
-         currjob = currjob->nextjob;
-      }
-
-      if( currjob->jobid == jobid )
-         return SCIP_JOB_INQUEUE;
-   }
-
-   return SCIP_JOB_DOESNOTEXIST;
-}
-
-/** returns whether the job id is running */
-static
-SCIP_Bool isJobRunning(
-   SCIP_JOBQUEUE*        currentjobs,        /**< queue of current jobs */
-   int                   jobid               /**< id of job to check */
-   )
-{
-   if( checkJobQueue(currentjobs, jobid) == SCIP_JOB_INQUEUE )
-      return TRUE;
-   else
-      return FALSE;
-}
-
 /** returns the number of threads */
 int SCIPtpiGetNumThreads(
    void
@@ -575,6 +691,7 @@ SCIP_RETCODE SCIPtpiCreateJob(
    (*job)->jobfunc = jobfunc;
    (*job)->args = jobarg;
    (*job)->nextjob = NULL;
+   (*job)->prevjob = NULL;
 
    return SCIP_OKAY;
 }
@@ -611,22 +728,44 @@ SCIP_RETCODE SCIPtpiSumbitJob(
 
 /** blocks until all jobs of the given jobid have finished
  *  and then returns the smallest SCIP_RETCODE of all the jobs
+ *
+ *  Only the jobs with the given jobid are waited for, jobs of other job ids may still be queued or running.
  */
 SCIP_RETCODE SCIPtpiCollectJobs(
    int                   jobid               /**< the jobid of the jobs to wait for */
    )
 {
    SCIP_RETCODE retcode;
+   SCIP_JOBGROUP* jobgroup;
+   SCIP_JOBGROUP* prevgroup;
    SCIP_JOB* currjob;
    SCIP_JOB* prevjob;
 
    SCIP_CALL( SCIPtpiAcquireLock(&(_threadpool->poollock)) );
 
-   while( isJobRunning(_threadpool->currentjobs, jobid) || isJobRunning(_threadpool->jobqueue, jobid) )
+   jobgroup = threadPoolFindJobGroup(_threadpool, jobid);
+
+   while( jobgroup != NULL && jobgroup->nunfinished > 0 )
    {
       SCIP_CALL( SCIPtpiWaitCondition(&_threadpool->jobfinished, &_threadpool->poollock) );
    }
 
+   /* removing the job group */
+   if( jobgroup != NULL )
+   {
+      if( jobgroup == _threadpool->jobgroups )
+         _threadpool->jobgroups = jobgroup->next;
+      else
+      {
+         prevgroup = _threadpool->jobgroups;
+         while( prevgroup->next != jobgroup )
+            prevgroup = prevgroup->next;
+         prevgroup->next = jobgroup->next;
+      }
+
+      BMSfreeMemory(&jobgroup);
+   }
+
    /* finding the location of the processed job in the currentjobs queue */
    retcode = SCIP_OKAY;
    currjob = _threadpool->finishedjobs->firstjob;
@@ -0,0 +1,314 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   microbench.c
+ * @brief  microbenchmarks for sorting, hash maps, and priority queues in misc.c
+ *
+ * Every kernel is run on the same random keys for a number of repetitions and timed with a wall clock of SCIP. The
+ * program prints the total time and the time per operation of each kernel, such that changes to these data structures
+ * can be measured in isolation. It does not check results; correctness is covered by the unit tests in tests/src/misc.
+ *
+ * Usage: microbench [number of keys [number of repetitions]]
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#define DEFAULT_NKEYS       100000 /**< default number of keys */
+#define DEFAULT_NREPS           10 /**< default number of repetitions of each kernel */
+#define RANDSEED              4711 /**< seed of the random keys */
+
+/** comparator of integers stored as pointers for the priority queue */
+static
+SCIP_DECL_SORTPTRCOMP(benchCompInt)
+{
+   int value1 = (int)(size_t)elem1;
+   int value2 = (int)(size_t)elem2;
+
+   return (value1 > value2) - (value1 < value2);
+}
+
+/** prints the result of a kernel */
+static
+void printResult(
+   const char*           name,               /**< name of the kernel */
+   SCIP_Real             time,               /**< total time of all repetitions */
+   int                   nops,               /**< number of operations per repetition */
+   int                   nreps               /**< number of repetitions */
+   )
+{
+   printf("%-28s %12.4f s %12.2f ns/op\n", name, time, 1e9 * time / ((SCIP_Real)nops * nreps));
+}
+
+/** sorts random integer keys together with a permutation */
+static
+SCIP_RETCODE benchSortIntInt(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CLOCK*           clock,              /**< clock to use */
+   const int*            keys,               /**< random keys */
+   int                   nkeys,              /**< number of keys */
+   int                   nreps               /**< number of repetitions */
+   )
+{
+   int* sortkeys;
+   int* perm;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortkeys, nkeys) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &perm, nkeys) );
+
+   SCIP_CALL( SCIPresetClock(scip, clock) );
+   for( r = 0; r < nreps; ++r )
+   {
+      BMScopyMemoryArray(sortkeys, keys, nkeys);
+      for( i = 0; i < nkeys; ++i )
+         perm[i] = i;
+
+      SCIP_CALL( SCIPstartClock(scip, clock) );
+      SCIPsortIntInt(sortkeys, perm, nkeys);
+      SCIP_CALL( SCIPstopClock(scip, clock) );
+   }
+   printResult("SCIPsortIntInt", SCIPgetClockTime(scip, clock), nkeys, nreps);
+
+   SCIPfreeBufferArray(scip, &perm);
+   SCIPfreeBufferArray(scip, &sortkeys);
+
+   return SCIP_OKAY;
+}
+
+/** sorts random real keys together with pointers */
+static
+SCIP_RETCODE benchSortRealPtr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CLOCK*           clock,              /**< clock to use */
+   const int*            keys,               /**< random keys */
+   int                   nkeys,              /**< number of keys */
+   int                   nreps               /**< number of repetitions */
+   )
+{
+   SCIP_Real* sortkeys;
+   void** ptrs;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortkeys, nkeys) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ptrs, nkeys) );
+
+   SCIP_CALL( SCIPresetClock(scip, clock) );
+   for( r = 0; r < nreps; ++r )
+   {
+      for( i = 0; i < nkeys; ++i )
+      {
+         sortkeys[i] = keys[i] / 7.0;
+         ptrs[i] = (void*)&keys[i];
+      }
+
+      SCIP_CALL( SCIPstartClock(scip, clock) );
+      SCIPsortRealPtr(sortkeys, ptrs, nkeys);
+      SCIP_CALL( SCIPstopClock(scip, clock) );
+   }
+   printResult("SCIPsortRealPtr", SCIPgetClockTime(scip, clock), nkeys, nreps);
+
+   SCIPfreeBufferArray(scip, &ptrs);
+   SCIPfreeBufferArray(scip, &sortkeys);
+
+   return SCIP_OKAY;
+}
+
+/** inserts all keys into a hash map, looks them up, and removes them */
+static
+SCIP_RETCODE benchHashmap(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CLOCK*           insertclock,        /**< clock for insertions */
+   SCIP_CLOCK*           lookupclock,        /**< clock for lookups */
+   SCIP_CLOCK*           removeclock,        /**< clock for removals */
+   const int*            keys,               /**< random keys */
+   int                   nkeys,              /**< number of keys */
+   int                   nreps               /**< number of repetitions */
+   )
+{
+   SCIP_HASHMAP* hashmap;
+   int sum = 0;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPresetClock(scip, insertclock) );
+   SCIP_CALL( SCIPresetClock(scip, lookupclock) );
+   SCIP_CALL( SCIPresetClock(scip, removeclock) );
+
+   for( r = 0; r < nreps; ++r )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&hashmap, SCIPblkmem(scip), nkeys) );
+
+      /* the origins are the addresses of the keys, which are distinct */
+      SCIP_CALL( SCIPstartClock(scip, insertclock) );
+      for( i = 0; i < nkeys; ++i )
+      {
+         SCIP_CALL( SCIPhashmapInsertInt(hashmap, (void*)&keys[i], keys[i]) );
+      }
+      SCIP_CALL( SCIPstopClock(scip, insertclock) );
+
+      SCIP_CALL( SCIPstartClock(scip, lookupclock) );
+      for( i = 0; i < nkeys; ++i )
+         sum += SCIPhashmapGetImageInt(hashmap, (void*)&keys[nkeys - 1 - i]) & 1;
+      SCIP_CALL( SCIPstopClock(scip, lookupclock) );
+
+      SCIP_CALL( SCIPstartClock(scip, removeclock) );
+      for( i = 0; i < nkeys; ++i )
+      {
+         SCIP_CALL( SCIPhashmapRemove(hashmap, (void*)&keys[i]) );
+      }
+      SCIP_CALL( SCIPstopClock(scip, removeclock) );
+
+      SCIPhashmapFree(&hashmap);
+   }
+
+   printResult("SCIPhashmapInsertInt", SCIPgetClockTime(scip, insertclock), nkeys, nreps);
+   printResult("SCIPhashmapGetImageInt", SCIPgetClockTime(scip, lookupclock), nkeys, nreps);
+   printResult("SCIPhashmapRemove", SCIPgetClockTime(scip, removeclock), nkeys, nreps);
+
+   /* print the checksum of the lookups, such that they cannot be optimized away */
+   printf("%-28s %12d\n", "  (lookup checksum)", sum);
+
+   return SCIP_OKAY;
+}
+
+/** inserts all keys into a priority queue and removes them in order */
+static
+SCIP_RETCODE benchPqueue(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CLOCK*           insertclock,        /**< clock for insertions */
+   SCIP_CLOCK*           removeclock,        /**< clock for removals */
+   const int*            keys,               /**< random keys */
+   int                   nkeys,              /**< number of keys */
+   int                   nreps               /**< number of repetitions */
+   )
+{
+   SCIP_PQUEUE* pqueue;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPresetClock(scip, insertclock) );
+   SCIP_CALL( SCIPresetClock(scip, removeclock) );
+
+   for( r = 0; r < nreps; ++r )
+   {
+      SCIP_CALL( SCIPpqueueCreate(&pqueue, nkeys, 2.0, benchCompInt, NULL) );
+
+      SCIP_CALL( SCIPstartClock(scip, insertclock) );
+      for( i = 0; i < nkeys; ++i )
+      {
+         SCIP_CALL( SCIPpqueueInsert(pqueue, (void*)(size_t)keys[i]) );
+      }
+      SCIP_CALL( SCIPstopClock(scip, insertclock) );
+
+      SCIP_CALL( SCIPstartClock(scip, removeclock) );
+      while( SCIPpqueueNElems(pqueue) > 0 )
+         (void) SCIPpqueueRemove(pqueue);
+      SCIP_CALL( SCIPstopClock(scip, removeclock) );
+
+      SCIPpqueueFree(&pqueue);
+   }
+
+   printResult("SCIPpqueueInsert", SCIPgetClockTime(scip, insertclock), nkeys, nreps);
+   printResult("SCIPpqueueRemove", SCIPgetClockTime(scip, removeclock), nkeys, nreps);
+
+   return SCIP_OKAY;
+}
+
+/** runs all microbenchmarks */
+static
+SCIP_RETCODE runBenchmarks(
+   int                   nkeys,              /**< number of keys */
+   int                   nreps               /**< number of repetitions */
+   )
+{
+   SCIP* scip = NULL;
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_CLOCK* clocks[3];
+   int* keys;
+   int c;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   for( c = 0; c < 3; ++c )
+   {
+      SCIP_CALL( SCIPcreateWallClock(scip, &clocks[c]) );
+   }
+
+   /* the keys are nonnegative, such that they can be stored as pointers in the priority queue */
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, RANDSEED, FALSE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, nkeys) );
+   SCIPrandomGetInts(randnumgen, 0, INT_MAX, keys, nkeys);
+
+   printf("%d keys, %d repetitions\n", nkeys, nreps);
+   printf("%-28s %14s %18s\n", "kernel", "total time", "time per op");
+
+   SCIP_CALL( benchSortIntInt(scip, clocks[0], keys, nkeys, nreps) );
+   SCIP_CALL( benchSortRealPtr(scip, clocks[0], keys, nkeys, nreps) );
+   SCIP_CALL( benchHashmap(scip, clocks[0], clocks[1], clocks[2], keys, nkeys, nreps) );
+   SCIP_CALL( benchPqueue(scip, clocks[0], clocks[1], keys, nkeys, nreps) );
+
+   SCIPfreeBufferArray(scip, &keys);
+   SCIPfreeRandom(scip, &randnumgen);
+
+   for( c = 2; c >= 0; --c )
+   {
+      SCIP_CALL( SCIPfreeClock(scip, &clocks[c]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   BMScheckEmptyMemory();
+
+   return SCIP_OKAY;
+}
+
+/** main method starting the microbenchmarks */
+int main(
+   int                   argc,               /**< number of arguments from the shell */
+   char**                argv                /**< array of shell arguments */
+   )
+{
+   SCIP_RETCODE retcode;
+   int nkeys = DEFAULT_NKEYS;
+   int nreps = DEFAULT_NREPS;
+
+   if( argc > 1 )
+      nkeys = atoi(argv[1]);
+   if( argc > 2 )
+      nreps = atoi(argv[2]);
+
+   if( argc > 3 || nkeys <= 0 || nreps <= 0 )
+   {
+      printf("usage: %s [number of keys [number of repetitions]]\n", argv[0]);
+      return EXIT_FAILURE;
+   }
+
+   retcode = runBenchmarks(nkeys, nreps);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPprintError(retcode);
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   fullstrong.c
+ * @brief  unit test checking that batched and sequential full strong branching select the same candidate
+ *
+ * A branching rule with high priority calls SCIPselectVarStrongBranching() at every node, once in sequential and once
+ * in batched mode, and compares the selected candidate and its score. This is done for all candidates and for a call in
+ * which only part of the candidates is complete and the remaining ones have skip flags, as done by the cloud and
+ * multi-aggregated branching rules. The branching decision itself is left to the default rules.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/branch_fullstrong.h"
+#include "include/scip_test.h"
+
+#define EPS 1e-6
+
+/* GLOBAL VARIABLES */
+static SCIP* scip = NULL;
+static int ncompared = 0;
+
+/** result of a strong branching selection */
+struct SelectResult
+{
+   int                   bestcand;           /**< best candidate for branching */
+   SCIP_Real             bestdown;           /**< objective value of the down branch for bestcand */
+   SCIP_Real             bestup;             /**< objective value of the up branch for bestcand */
+   SCIP_Real             bestscore;          /**< score for bestcand */
+   SCIP_Bool             bestdownvalid;      /**< is bestdown a valid dual bound for the down branch? */
+   SCIP_Bool             bestupvalid;        /**< is bestup a valid dual bound for the up branch? */
+   SCIP_Real             provedbound;        /**< proved dual bound for current subtree */
+   SCIP_RESULT           result;             /**< result of the selection */
+};
+typedef struct SelectResult SELECTRESULT;
+
+/** calls full strong branching in the given mode */
+static
+SCIP_RETCODE selectStrongBranching(
+   SCIP_Bool             batched,            /**< should the batched mode be used? */
+   SCIP_VAR**            lpcands,            /**< branching candidates */
+   SCIP_Real*            lpcandssol,         /**< solution values of the branching candidates */
+   SCIP_Real*            lpcandsfrac,        /**< fractional values of the branching candidates */
+   SCIP_Bool*            skipdown,           /**< should down branchings be skipped? */
+   SCIP_Bool*            skipup,             /**< should up branchings be skipped? */
+   int                   nlpcands,           /**< number of branching candidates */
+   int                   ncomplete,          /**< number of branching candidates without skip */
+   SELECTRESULT*         res                 /**< pointer to store the result */
+   )
+{
+   int start = 0;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "branching/fullstrong/batched", batched) );
+
+   res->result = SCIP_DIDNOTRUN;
+   SCIP_CALL( SCIPselectVarStrongBranching(scip, lpcands, lpcandssol, lpcandsfrac, skipdown, skipup, nlpcands,
+         nlpcands, ncomplete, &start, 0, FALSE, FALSE, &res->bestcand, &res->bestdown, &res->bestup, &res->bestscore,
+         &res->bestdownvalid, &res->bestupvalid, &res->provedbound, &res->result) );
+
+   return SCIP_OKAY;
+}
+
+/** branching execution method comparing sequential and batched full strong branching */
+static
+SCIP_DECL_BRANCHEXECLP(branchExeclpCompare)
+{  /*lint --e{715}*/
+   SCIP_VAR** tmpcands;
+   SCIP_Real* tmpcandssol;
+   SCIP_Real* tmpcandsfrac;
+   SCIP_VAR** lpcands;
+   SCIP_Real* lpcandssol;
+   SCIP_Real* lpcandsfrac;
+   SCIP_Bool* skipdown;
+   SCIP_Bool* skipup;
+   int nlpcands;
+   int round;
+   int i;
+
+   *result = SCIP_DIDNOTRUN;
+
+   SCIP_CALL( SCIPgetLPBranchCands(scip, &tmpcands, &tmpcandssol, &tmpcandsfrac, &nlpcands, NULL, NULL) );
+
+   if( nlpcands < 2 )
+      return SCIP_OKAY;
+
+   /* the candidate arrays of SCIP may change during strong branching, so work on copies */
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &lpcands, tmpcands, nlpcands) );
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &lpcandssol, tmpcandssol, nlpcands) );
+   SCIP_CALL( SCIPduplicateBufferArray(scip, &lpcandsfrac, tmpcandsfrac, nlpcands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &skipdown, nlpcands) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &skipup, nlpcands) );
+
+   /* round 0: all candidates are complete; round 1: only the first half is complete, the others skip one or both
+    * directions
+    */
+   for( round = 0; round < 2 && *result == SCIP_DIDNOTRUN; ++round )
+   {
+      SELECTRESULT sequential;
+      SELECTRESULT batched;
+      int ncomplete;
+
+      ncomplete = (round == 0 ? nlpcands : nlpcands / 2);
+
+      for( i = 0; i < nlpcands; ++i )
+      {
+         skipdown[i] = (i >= ncomplete);
+         skipup[i] = (i >= ncomplete && i % 2 == 0);
+      }
+
+      SCIP_CALL( selectStrongBranching(FALSE, lpcands, lpcandssol, lpcandsfrac, skipdown, skipup, nlpcands, ncomplete,
+            &sequential) );
+
+      /* a bound change or cutoff modifies the node, so the second call would see a different LP */
+      if( sequential.result == SCIP_CUTOFF || sequential.result == SCIP_REDUCEDDOM )
+      {
+         *result = sequential.result;
+         break;
+      }
+
+      SCIP_CALL( selectStrongBranching(TRUE, lpcands, lpcandssol, lpcandsfrac, skipdown, skipup, nlpcands, ncomplete,
+            &batched) );
+
+      cr_assert_eq(batched.result, sequential.result, "results differ: %d != %d\n", batched.result, sequential.result);
+      cr_assert_eq(batched.bestcand, sequential.bestcand, "selected candidates differ: %d != %d\n", batched.bestcand,
+         sequential.bestcand);
+      cr_assert_float_eq(batched.bestscore, sequential.bestscore, EPS, "scores differ: %g != %g\n", batched.bestscore,
+         sequential.bestscore);
+      cr_assert_float_eq(batched.bestdown, sequential.bestdown, EPS);
+      cr_assert_float_eq(batched.bestup, sequential.bestup, EPS);
+      cr_assert_eq(batched.bestdownvalid, sequential.bestdownvalid);
+      cr_assert_eq(batched.bestupvalid, sequential.bestupvalid);
+
+      ++ncompared;
+   }
+
+   SCIPfreeBufferArray(scip, &skipup);
+   SCIPfreeBufferArray(scip, &skipdown);
+   SCIPfreeBufferArray(scip, &lpcandsfrac);
+   SCIPfreeBufferArray(scip, &lpcandssol);
+   SCIPfreeBufferArray(scip, &lpcands);
+
+   return SCIP_OKAY;
+}
+
+/* TEST SUITE */
+static
+void setup(void)
+{
+   SCIP_BRANCHRULE* branchrule;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+
+   SCIP_CALL( SCIPincludeBranchruleBasic(scip, &branchrule, "compare", "compares batched and sequential strong branching",
+         1000000, -1, 1.0, NULL) );
+   SCIP_CALL( SCIPsetBranchruleExecLp(scip, branchrule, branchExeclpCompare) );
+
+   /* re-evaluate all candidates in every call, such that the second call does not reuse the values of the first */
+   SCIP_CALL( SCIPsetLongintParam(scip, "branching/fullstrong/reevalage", 0LL) );
+
+   SCIPsetMessagehdlrQuiet(scip, TRUE);
+
+   ncompared = 0;
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(fullstrong, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** batched and sequential strong branching select the same candidate with the same score */
+Test(fullstrong, batchedequalssequential)
+{
+   char testfile[SCIP_MAXSTRLEN];
+
+   /* we take bell5.mps as our instance */
+   strcpy(testfile, __FILE__);
+   testfile[strlen(testfile) - 12] = '\0';  /* cutoff "fullstrong.c" */
+   strcat(testfile, "../../../check/instances/MIP/bell5.mps");
+   SCIP_CALL( SCIPreadProb(scip, testfile, NULL) );
+
+   /* keep fractional candidates at the nodes */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 20LL) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_gt(ncompared, 0, "strong branching was never compared");
+}
@@ -0,0 +1,189 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   createconss.c
+ * @brief  unit test checking that SCIPcreateConssLinear() creates the same constraints as SCIPcreateConsLinear()
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/cons_linear.h"
+#include "scip/scipdefplugins.h"
+#include "include/scip_test.h"
+
+#define NVARS  3
+#define NCONSS 6
+#define NNONZS 10
+
+/* GLOBAL VARIABLES */
+static SCIP* scip = NULL;
+static SCIP_VAR* vars[NVARS];
+
+/* constraint matrix in compressed sparse row format; the rows are
+ *
+ *  0: empty row with finite sides
+ *  1: x + 2y - z <= 4 with infinite left hand side
+ *  2: empty row with both sides infinite
+ *  3: -inf <= x + y <= inf, sides beyond infinity
+ *  4: x appears twice and y cancels out
+ *  5: equation z = 1
+ */
+static const char* consnames[NCONSS] = { "empty", "rhsonly", "emptyfree", "free", "duplicate", "equation" };
+static int consbeg[NCONSS + 1] = { 0, 0, 3, 3, 5, 9, 10 };
+static int consind[NNONZS] = { 0, 1, 2, 0, 1, 0, 1, 0, 1, 2 };
+static SCIP_Real consvals[NNONZS] = { 1.0, 2.0, -1.0, 1.0, 1.0, 1.0, 1.0, 2.0, -1.0, 1.0 };
+static SCIP_Real conslhs[NCONSS] = { -1.0, -1e+20, -1e+20, -1e+30, 2.0, 1.0 };
+static SCIP_Real consrhs[NCONSS] = { 1.0, 4.0, 1e+20, 1e+30, 6.0, 1.0 };
+
+/* TEST SUITE */
+static
+void setup(void)
+{
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "createconss") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[0], "x", 0.0, 5.0, 1.0, SCIP_VARTYPE_INTEGER) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[1], "y", 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &vars[2], "z", -2.0, 2.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+}
+
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** creates the constraints with SCIPcreateConssLinear() and row by row with SCIPcreateConsLinear() and compares them */
+static
+void compareCreation(
+   SCIP_VAR**            consvars            /**< variables to use in the constraints */
+   )
+{
+   SCIP_CONS* conss[NCONSS];
+   SCIP_CONS* cons;
+   SCIP_VAR* nonzvars[NNONZS];
+   int c;
+   int i;
+
+   for( i = 0; i < NNONZS; ++i )
+      nonzvars[i] = consvars[consind[i]];
+
+   /* create the constraints with different flags than the basic ones to check that the flags are passed on */
+   SCIP_CALL( SCIPcreateConssLinear(scip, conss, NCONSS, consnames, consbeg, nonzvars, consvals, conslhs, consrhs,
+         FALSE, TRUE, FALSE, TRUE, FALSE, FALSE, FALSE, TRUE, TRUE, FALSE) );
+
+   for( c = 0; c < NCONSS; ++c )
+   {
+      SCIP_VAR** vars1;
+      SCIP_VAR** vars2;
+      SCIP_Real* vals1;
+      SCIP_Real* vals2;
+      int nvars;
+
+      SCIP_CALL( SCIPcreateConsLinear(scip, &cons, consnames[c], consbeg[c+1] - consbeg[c],
+            consbeg[c+1] > consbeg[c] ? &nonzvars[consbeg[c]] : NULL,
+            consbeg[c+1] > consbeg[c] ? &consvals[consbeg[c]] : NULL, conslhs[c], consrhs[c],
+            FALSE, TRUE, FALSE, TRUE, FALSE, FALSE, FALSE, TRUE, TRUE, FALSE) );
+
+      cr_assert_str_eq(SCIPconsGetName(conss[c]), SCIPconsGetName(cons));
+      cr_assert_str_eq(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), "linear");
+      cr_assert_eq(SCIPconsIsTransformed(conss[c]), SCIPconsIsTransformed(cons));
+
+      cr_expect_eq(SCIPgetLhsLinear(scip, conss[c]), SCIPgetLhsLinear(scip, cons), "left hand sides of <%s> differ\n",
+         consnames[c]);
+      cr_expect_eq(SCIPgetRhsLinear(scip, conss[c]), SCIPgetRhsLinear(scip, cons), "right hand sides of <%s> differ\n",
+         consnames[c]);
+
+      nvars = SCIPgetNVarsLinear(scip, cons);
+      cr_assert_eq(SCIPgetNVarsLinear(scip, conss[c]), nvars, "number of variables of <%s> differ\n", consnames[c]);
+
+      vars1 = SCIPgetVarsLinear(scip, conss[c]);
+      vars2 = SCIPgetVarsLinear(scip, cons);
+      vals1 = SCIPgetValsLinear(scip, conss[c]);
+      vals2 = SCIPgetValsLinear(scip, cons);
+      for( i = 0; i < nvars; ++i )
+      {
+         cr_expect_eq(vars1[i], vars2[i], "variable %d of <%s> differs\n", i, consnames[c]);
+         cr_expect_eq(vals1[i], vals2[i], "coefficient %d of <%s> differs\n", i, consnames[c]);
+      }
+
+      cr_expect_eq(SCIPconsIsInitial(conss[c]), SCIPconsIsInitial(cons));
+      cr_expect_eq(SCIPconsIsSeparated(conss[c]), SCIPconsIsSeparated(cons));
+      cr_expect_eq(SCIPconsIsEnforced(conss[c]), SCIPconsIsEnforced(cons));
+      cr_expect_eq(SCIPconsIsChecked(conss[c]), SCIPconsIsChecked(cons));
+      cr_expect_eq(SCIPconsIsPropagated(conss[c]), SCIPconsIsPropagated(cons));
+      cr_expect_eq(SCIPconsIsLocal(conss[c]), SCIPconsIsLocal(cons));
+      cr_expect_eq(SCIPconsIsModifiable(conss[c]), SCIPconsIsModifiable(cons));
+      cr_expect_eq(SCIPconsIsDynamic(conss[c]), SCIPconsIsDynamic(cons));
+      cr_expect_eq(SCIPconsIsRemovable(conss[c]), SCIPconsIsRemovable(cons));
+      cr_expect_eq(SCIPconsIsStickingAtNode(conss[c]), SCIPconsIsStickingAtNode(cons));
+
+      /* both constraints can be added to the problem */
+      SCIP_CALL( SCIPaddCons(scip, conss[c]) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &conss[c]) );
+   }
+}
+
+TestSuite(createconss, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(createconss, problemstage, .description = "compare the constraints created in the problem stage")
+{
+   compareCreation(vars);
+
+   cr_assert_eq(SCIPgetNConss(scip), 2 * NCONSS);
+}
+
+Test(createconss, transformedstage, .description = "compare the constraints created in the transformed stage")
+{
+   SCIP_VAR* transvars[NVARS];
+
+   SCIP_CALL( SCIPtransformProb(scip) );
+   SCIP_CALL( SCIPgetTransformedVars(scip, NVARS, vars, transvars) );
+
+   compareCreation(transvars);
+}
+
+Test(createconss, noconss, .description = "check that creating no constraints does nothing")
+{
+   int beg = 0;
+
+   SCIP_CALL( SCIPcreateConssLinear(scip, NULL, 0, NULL, &beg, NULL, NULL, NULL, NULL,
+         TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   cr_assert_eq(SCIPgetNConss(scip), 0);
+}
@@ -26,6 +26,7 @@
 #include <lpi/lpi.h>
 
 #include "include/scip_test.h"
+#include "lpi_test.h"
 
 #define EPS 1e-6
 
@@ -41,18 +42,6 @@ typedef enum SCIPfeasStatus SCIPFEASSTATUS;
 /* global variables */
 static SCIP_LPI* lpi = NULL;
 
-/* macro for parameters */
-#define SCIP_CALL_PARAM(x) /*lint -e527 */ do                                                   \
-{                                                                                               \
-   SCIP_RETCODE _restat_;                                                                       \
-   if ( (_restat_ = (x)) != SCIP_OKAY && (_restat_ != SCIP_PARAMETERUNKNOWN) )                  \
-   {                                                                                            \
-      SCIPerrorMessage("[%s:%d] Error <%d> in function call\n", __FILE__, __LINE__, _restat_);  \
-      abort();                                                                                  \
-   }                                                                                            \
-}                                                                                               \
-while ( FALSE )
-
 /** macro to keep control of infinity
  *
  *  Some LPIs use std::numeric_limits<SCIP_Real>::infinity() as finity value. Comparing two infinty values then yields
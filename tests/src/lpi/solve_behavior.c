@@ -19,6 +19,7 @@
  *    Methods tested are:
  *       SCIPlpiSolveBarier(), SCIPlpiWasSolved()
  *       SCIPlpiHas{Simplex,Barrier}Solve()
+ *       SCIPlpiIs{Objlim,Iterlim}Exc() after solving with objective and iteration limits
  *
  * @author Franziska Schloesser
  */
@@ -29,7 +30,9 @@
 #include <lpi/lpi.h>
 
 #include <signal.h>
+#include <limits.h>
 #include "include/scip_test.h"
+#include "lpi_test.h"
 
 #define EPS 1e-6
 
@@ -178,6 +181,156 @@ Test(solve_behavior, testbarriersolve)
    }
 }
 
+/** Test that a crossed objective limit is reported consistently when solving from scratch
+ *
+ *  For maximization, the LP solver stops as soon as the objective is known to be below the limit. The optimal value
+ *  of the problem is 14, so a limit of 20 is crossed. Depending on when the LP solver checks the limit, it either stops
+ *  at the limit or solves the problem to optimality, but it never reports both.
+ */
+Test(solve_behavior, testobjlimit)
+{
+   SCIP_Real objval;
+   int nrows, ncols;
+
+   /* initialize */
+   initProb(&ncols, &nrows);
+
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_FROMSCRATCH, 1) );
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_PRESOLVING, 0) );
+   SCIP_CALL( SCIPlpiSetRealpar(lpi, SCIP_LPPAR_OBJLIM, 20.0) );
+
+   /* solve problem */
+   SCIP_CALL( SCIPlpiSolveDual(lpi) );
+
+   cr_assert( SCIPlpiWasSolved(lpi) );
+   cr_assert( SCIPlpiIsObjlimExc(lpi) || SCIPlpiIsOptimal(lpi) );
+   cr_assert( ! (SCIPlpiIsObjlimExc(lpi) && SCIPlpiIsOptimal(lpi)) );
+   cr_assert( ! SCIPlpiIsIterlimExc(lpi) );
+   cr_assert( ! SCIPlpiIsTimelimExc(lpi) );
+
+   /* the dual bound must not be better than the objective limit */
+   SCIP_CALL( SCIPlpiGetObjval(lpi, &objval) );
+   cr_assert_leq(objval, 20.0 + EPS, "Objective value exceeds objective limit: %g > %g\n", objval, 20.0);
+}
+
+/** Test that the dual simplex stops at an objective limit that is crossed by the starting basis
+ *
+ *  The problem is solved to optimality (x1 = 0, x2 = 6, x3 = 8 with value 14). Then the upper bound of x2 is decreased
+ *  to 3, such that the optimal basis stays dual feasible but becomes primal infeasible; the new optimal value is 11.
+ *  The dual simplex starts from the old basis, whose objective value 14 is already below the limit of 20, so it may
+ *  stop at the limit. As in the objective limit test of solve.c, an LP solver may also solve the problem to optimality
+ *  instead, since it is not required to check the limit before it starts iterating.
+ */
+Test(solve_behavior, testobjlimitexceeded)
+{
+   SCIP_Real objval;
+   SCIP_Real lb;
+   SCIP_Real ub;
+   int nrows, ncols;
+   int ind;
+
+   /* initialize */
+   initProb(&ncols, &nrows);
+
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_FROMSCRATCH, 0) );
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_PRESOLVING, 0) );
+
+   /* solve problem to optimality */
+   SCIP_CALL( SCIPlpiSolveDual(lpi) );
+   cr_assert( SCIPlpiIsOptimal(lpi) );
+   SCIP_CALL( SCIPlpiGetObjval(lpi, &objval) );
+   cr_assert_float_eq(objval, 14.0, EPS);
+
+   /* cut off the optimal solution and set a limit that the current basis already crosses */
+   ind = 1;
+   lb = 0.0;
+   ub = 3.0;
+   SCIP_CALL( SCIPlpiChgBounds(lpi, 1, &ind, &lb, &ub) );
+   SCIP_CALL( SCIPlpiSetRealpar(lpi, SCIP_LPPAR_OBJLIM, 20.0) );
+
+   /* resolve problem */
+   SCIP_CALL( SCIPlpiSolveDual(lpi) );
+
+   cr_assert( SCIPlpiWasSolved(lpi) );
+   cr_assert( SCIPlpiIsObjlimExc(lpi) || SCIPlpiIsOptimal(lpi) );
+   cr_assert( ! (SCIPlpiIsObjlimExc(lpi) && SCIPlpiIsOptimal(lpi)) );
+   cr_assert( ! SCIPlpiIsIterlimExc(lpi) );
+   cr_assert( ! SCIPlpiIsTimelimExc(lpi) );
+
+   if( SCIPlpiIsOptimal(lpi) )
+   {
+      SCIP_CALL( SCIPlpiGetObjval(lpi, &objval) );
+      cr_assert_float_eq(objval, 11.0, EPS);
+   }
+}
+
+/** Test that an objective limit that is never crossed does not stop the LP solver
+ *
+ *  For maximization, the LP solver only stops if the objective is known to be below the limit. The optimal value of
+ *  the problem is 14, so a limit of 10 is never crossed and the problem has to be solved to optimality.
+ */
+Test(solve_behavior, testobjlimitnotreached)
+{
+   SCIP_Real objval;
+   int nrows, ncols;
+
+   /* initialize */
+   initProb(&ncols, &nrows);
+
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_FROMSCRATCH, 1) );
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_PRESOLVING, 0) );
+   SCIP_CALL( SCIPlpiSetRealpar(lpi, SCIP_LPPAR_OBJLIM, 10.0) );
+
+   /* solve problem */
+   SCIP_CALL( SCIPlpiSolveDual(lpi) );
+
+   cr_assert( SCIPlpiWasSolved(lpi) );
+   cr_assert( SCIPlpiIsOptimal(lpi) );
+   cr_assert( ! SCIPlpiIsObjlimExc(lpi) );
+   cr_assert( ! SCIPlpiIsIterlimExc(lpi) );
+   cr_assert( ! SCIPlpiIsTimelimExc(lpi) );
+
+   SCIP_CALL( SCIPlpiGetObjval(lpi, &objval) );
+   cr_assert_float_eq(objval, 14.0, EPS);
+}
+
+/** Test that an iteration limit is respected by the primal simplex and reported consistently */
+Test(solve_behavior, testiterlimit)
+{
+   SCIP_Real objval;
+   int iterations;
+   int nrows, ncols;
+
+   /* initialize */
+   initProb(&ncols, &nrows);
+
+   /* solve from scratch with a single simplex iteration */
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_FROMSCRATCH, 1) );
+   SCIP_CALL_PARAM( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_PRESOLVING, 0) );
+   SCIP_CALL( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_LPITLIM, 1) );
+   SCIP_CALL( SCIPlpiSolvePrimal(lpi) );
+
+   /* the LP solver may stop at the limit or be optimal already, but never report both */
+   cr_assert( SCIPlpiIsIterlimExc(lpi) || SCIPlpiIsOptimal(lpi) );
+   cr_assert( ! (SCIPlpiIsIterlimExc(lpi) && SCIPlpiIsOptimal(lpi)) );
+   cr_assert( ! SCIPlpiIsObjlimExc(lpi) );
+   cr_assert( ! SCIPlpiIsTimelimExc(lpi) );
+
+   SCIP_CALL( SCIPlpiGetIterations(lpi, &iterations) );
+   cr_assert_leq(iterations, 1, "Iteration limit exceeded: %d > %d\n", iterations, 1);
+
+   /* lifting the limit has to solve the problem to optimality */
+   SCIP_CALL( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_LPITLIM, INT_MAX) );
+   SCIP_CALL( SCIPlpiSolvePrimal(lpi) );
+
+   cr_assert( SCIPlpiWasSolved(lpi) );
+   cr_assert( SCIPlpiIsOptimal(lpi) );
+   cr_assert( ! SCIPlpiIsIterlimExc(lpi) );
+
+   SCIP_CALL( SCIPlpiGetObjval(lpi, &objval) );
+   cr_assert_float_eq(objval, 14.0, EPS);
+}
+
 /** Test if the two method giving information about availability of solve methods do not crash. */
 Test(solve_behavior, testhassolve)
 {
@@ -0,0 +1,193 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   chunkpool.c
+ * @brief  unit test for the chunk pool shared between block memories
+ *
+ * Two block memories share a chunk pool. Each of them frees its chunks into the pool and allocates chunks that the
+ * other one has freed. Finally, the block memories and the pool are freed in different orders.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "include/scip_test.h"
+
+#define NELEMS     1000                      /**< number of elements allocated in each round */
+#define ELEMSIZE   (4 * sizeof(void*))       /**< size of the elements */
+#define POOLSIZE   (1LL << 24)               /**< maximal size of the pool, large enough for all chunks */
+
+/* global variables */
+static BMS_CHKPOOL* chunkpool;
+static BMS_BLKMEM* blkmem1;
+static BMS_BLKMEM* blkmem2;
+
+/** allocates elements in the block memory and fills them with a pattern */
+static
+void allocElems(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   void**                elems,              /**< array to store the elements */
+   int                   pattern             /**< pattern to write into the elements */
+   )
+{
+   int i;
+
+   for( i = 0; i < NELEMS; ++i )
+   {
+      BMSallocBlockMemorySize(blkmem, &elems[i], ELEMSIZE);
+      cr_assert_not_null(elems[i]);
+      BMSclearMemorySize(elems[i], ELEMSIZE);
+      *(int*)elems[i] = pattern + i;
+   }
+}
+
+/** checks the pattern of the elements and frees them; the chunks are returned to the pool by garbage collection */
+static
+void freeElems(
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   void**                elems,              /**< elements to free */
+   int                   pattern             /**< pattern that was written into the elements */
+   )
+{
+   int i;
+
+   for( i = 0; i < NELEMS; ++i )
+   {
+      cr_assert_eq(*(int*)elems[i], pattern + i, "element %d was overwritten\n", i);
+      BMSfreeBlockMemorySize(blkmem, &elems[i], ELEMSIZE);
+   }
+
+   BMSgarbagecollectBlockMemory(blkmem);
+   cr_assert_eq(BMSgetBlockMemoryAllocated(blkmem), 0);
+}
+
+/** lets both block memories reuse the chunks that the other one has freed */
+static
+void exchangeChunks(void)
+{
+   void* elems1[NELEMS];
+   void* elems2[NELEMS];
+   long long poolmem;
+   long long nreused;
+
+   /* the first block memory fills the pool */
+   allocElems(blkmem1, elems1, 0);
+   cr_assert_eq(BMSgetChunkPoolNReused(chunkpool), 0);
+   freeElems(blkmem1, elems1, 0);
+
+   poolmem = BMSgetChunkPoolMemory(chunkpool);
+   cr_assert_gt(poolmem, 0, "no chunks were returned to the pool");
+
+   /* the second block memory takes all chunks of the first one, since it allocates chunks of the same sizes */
+   allocElems(blkmem2, elems2, NELEMS);
+   cr_assert_eq(BMSgetChunkPoolMemory(chunkpool), 0, "the chunks of the first block memory were not reused");
+   nreused = BMSgetChunkPoolNReused(chunkpool);
+   cr_assert_gt(nreused, 0);
+
+   /* while the second block memory holds the chunks, the first one has to allocate new ones */
+   allocElems(blkmem1, elems1, 2 * NELEMS);
+   cr_assert_eq(BMSgetChunkPoolNReused(chunkpool), nreused);
+
+   /* the first block memory takes back the chunks that the second one frees */
+   freeElems(blkmem2, elems2, NELEMS);
+   cr_assert_eq(BMSgetChunkPoolMemory(chunkpool), poolmem);
+   freeElems(blkmem1, elems1, 2 * NELEMS);
+   cr_assert_eq(BMSgetChunkPoolMemory(chunkpool), 2 * poolmem);
+
+   allocElems(blkmem1, elems1, 3 * NELEMS);
+   cr_assert_eq(BMSgetChunkPoolMemory(chunkpool), poolmem);
+   cr_assert_eq(BMSgetChunkPoolNReused(chunkpool), 2 * nreused);
+
+   /* keep elements allocated, such that the block memories are destroyed while they still use chunks */
+   allocElems(blkmem2, elems2, 4 * NELEMS);
+   cr_assert_eq(BMSgetChunkPoolMemory(chunkpool), 0);
+   cr_assert_eq(BMSgetChunkPoolMemoryMax(chunkpool), 2 * poolmem);
+}
+
+/** setup of test run */
+static
+void setup(void)
+{
+   chunkpool = BMScreateChunkPool(POOLSIZE);
+   cr_assert_not_null(chunkpool);
+
+   blkmem1 = BMScreateBlockMemory(1, -1);
+   blkmem2 = BMScreateBlockMemory(1, -1);
+   cr_assert_not_null(blkmem1);
+   cr_assert_not_null(blkmem2);
+
+   BMSsetBlockMemoryChunkPool(blkmem1, chunkpool);
+   BMSsetBlockMemoryChunkPool(blkmem2, chunkpool);
+   cr_assert_eq(BMSgetBlockMemoryChunkPool(blkmem1), chunkpool);
+   cr_assert_eq(BMSgetBlockMemoryChunkPool(blkmem2), chunkpool);
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   cr_assert_null(chunkpool);
+   cr_assert_null(blkmem1);
+   cr_assert_null(blkmem2);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(chunkpool, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+Test(chunkpool, firstfirst, .description = "exchange chunks and destroy the first block memory first")
+{
+   exchangeChunks();
+
+   BMSreleaseChunkPool(&chunkpool);
+   BMSdestroyBlockMemory(&blkmem1);
+   BMSdestroyBlockMemory(&blkmem2);
+}
+
+Test(chunkpool, secondfirst, .description = "exchange chunks and destroy the second block memory first")
+{
+   exchangeChunks();
+
+   BMSreleaseChunkPool(&chunkpool);
+   BMSdestroyBlockMemory(&blkmem2);
+   BMSdestroyBlockMemory(&blkmem1);
+}
+
+Test(chunkpool, poollast, .description = "exchange chunks and release the pool after both block memories")
+{
+   exchangeChunks();
+
+   BMSdestroyBlockMemory(&blkmem2);
+   BMSdestroyBlockMemory(&blkmem1);
+
+   /* the chunks of both block memories are kept in the pool until it is released */
+   cr_assert_gt(BMSgetChunkPoolMemory(chunkpool), 0);
+   BMSreleaseChunkPool(&chunkpool);
+}
+
+Test(chunkpool, detach, .description = "exchange chunks and detach the pool before destroying the block memories")
+{
+   exchangeChunks();
+
+   BMSsetBlockMemoryChunkPool(blkmem1, NULL);
+   cr_assert_null(BMSgetBlockMemoryChunkPool(blkmem1));
+   BMSreleaseChunkPool(&chunkpool);
+
+   /* the chunks of the first block memory are freed directly, the ones of the second go to the pool */
+   BMSdestroyBlockMemory(&blkmem1);
+   BMSdestroyBlockMemory(&blkmem2);
+}
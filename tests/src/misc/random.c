@@ -0,0 +1,130 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   random.c
+ * @brief  unittest for the random number generators and the bulk fill methods in misc.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+#define NVALS 1000
+#define SEED  42
+
+static SCIP* scip;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** checks that the bulk fill methods return the same values as the single draws */
+static
+void checkBulkFill(
+   SCIP_Bool             usexoshiro          /**< should xoshiro256++ be used? */
+   )
+{
+   SCIP_RANDNUMGEN* single;
+   SCIP_RANDNUMGEN* bulk;
+   SCIP_Real reals[NVALS];
+   int ints[NVALS];
+   int i;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "randomization/usexoshiro", usexoshiro) );
+   SCIP_CALL( SCIPcreateRandom(scip, &single, SEED, TRUE) );
+   SCIP_CALL( SCIPcreateRandom(scip, &bulk, SEED, TRUE) );
+
+   SCIPrandomGetInts(bulk, -5, 17, ints, NVALS);
+   for( i = 0; i < NVALS; ++i )
+   {
+      cr_assert_eq(ints[i], SCIPrandomGetInt(single, -5, 17), "integer %d differs\n", i);
+      cr_assert(-5 <= ints[i] && ints[i] <= 17);
+   }
+
+   SCIPrandomGetReals(bulk, -1.5, 2.5, reals, NVALS);
+   for( i = 0; i < NVALS; ++i )
+   {
+      cr_assert_eq(reals[i], SCIPrandomGetReal(single, -1.5, 2.5), "real %d differs\n", i);
+      cr_assert(-1.5 <= reals[i] && reals[i] <= 2.5);
+   }
+
+   /* the full integer range must not overflow */
+   SCIPrandomGetInts(bulk, INT_MIN, INT_MAX, ints, NVALS);
+   for( i = 0; i < NVALS; ++i )
+      cr_assert_eq(ints[i], SCIPrandomGetInt(single, INT_MIN, INT_MAX), "integer %d differs\n", i);
+
+   SCIPfreeRandom(scip, &bulk);
+   SCIPfreeRandom(scip, &single);
+}
+
+TestSuite(random, .init = setup, .fini = teardown);
+
+Test(random, bulkfill_kiss, .description = "test that the bulk fill methods match single draws of KISS")
+{
+   checkBulkFill(FALSE);
+}
+
+Test(random, bulkfill_xoshiro, .description = "test that the bulk fill methods match single draws of xoshiro256++")
+{
+   checkBulkFill(TRUE);
+}
+
+Test(random, xoshiro_stream, .description = "test that xoshiro256++ is reproducible and differs from KISS")
+{
+   SCIP_RANDNUMGEN* kiss;
+   SCIP_RANDNUMGEN* xoshiro;
+   int kissvals[NVALS];
+   int xoshirovals[NVALS];
+   int nequal;
+   int i;
+
+   SCIP_CALL( SCIPcreateRandom(scip, &kiss, SEED, TRUE) );
+   SCIP_CALL( SCIPsetBoolParam(scip, "randomization/usexoshiro", TRUE) );
+   SCIP_CALL( SCIPcreateRandom(scip, &xoshiro, SEED, TRUE) );
+
+   SCIPrandomGetInts(kiss, 0, 1000000, kissvals, NVALS);
+   SCIPrandomGetInts(xoshiro, 0, 1000000, xoshirovals, NVALS);
+
+   nequal = 0;
+   for( i = 0; i < NVALS; ++i )
+   {
+      if( kissvals[i] == xoshirovals[i] )
+         ++nequal;
+   }
+   cr_assert_lt(nequal, 10, "xoshiro256++ reproduces %d values of KISS\n", nequal);
+
+   /* resetting the seed restarts the stream of the selected generator */
+   SCIPsetRandomSeed(scip, xoshiro, SEED);
+   for( i = 0; i < NVALS; ++i )
+      cr_assert_eq(SCIPrandomGetInt(xoshiro, 0, 1000000), xoshirovals[i], "value %d differs after reseeding\n", i);
+
+   SCIPfreeRandom(scip, &xoshiro);
+   SCIPfreeRandom(scip, &kiss);
+}
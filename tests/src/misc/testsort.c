@@ -19,6 +19,7 @@
  */
 
 #include<stdio.h>
+#include<limits.h>
 
 #include "scip/pub_misc.h"
 #include "scip/scip.h"
@@ -60,6 +61,71 @@ static SCIP* scip;
 static int* tosort;
 static int ntosort;
 
+/** fills an array that is long enough to be sorted by radix sort with keys containing INT_MIN, INT_MAX, negative
+ *  numbers and duplicates, and stores the original position of each key in the partner array
+ */
+static
+void fillRadixKeys(
+   int*                  keys,               /**< array to fill with keys */
+   int*                  origpos,            /**< array to store the original positions */
+   int                   len                 /**< length of arrays */
+   )
+{
+   unsigned int seed = 42;
+   int i;
+
+   for( i = 0; i < len; ++i )
+   {
+      seed = seed * 1103515245u + 12345u;
+
+      /* values in [-5000,5000) produce many duplicates, the others spread over the full range of int */
+      if( i % 2 == 0 )
+         keys[i] = (int)((seed >> 8) % 10000u) - 5000;
+      else
+         keys[i] = (int)seed;
+      origpos[i] = i;
+   }
+
+   keys[0] = INT_MAX;
+   keys[len / 3] = INT_MIN;
+   keys[len / 2] = INT_MIN;
+   keys[len - 1] = INT_MAX;
+   keys[len - 2] = -1;
+   keys[len - 3] = 0;
+}
+
+/** checks that the partner array is a permutation that moved each key together with its partner entry, and that
+ *  equal keys keep their original order
+ */
+static
+void checkRadixPartners(
+   int*                  keys,               /**< sorted keys */
+   int*                  origpos,            /**< original positions sorted together with the keys */
+   int*                  origkeys,           /**< keys before sorting */
+   int                   len                 /**< length of arrays */
+   )
+{
+   SCIP_Bool* seen;
+   int i;
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &seen, len) );
+
+   for( i = 0; i < len; ++i )
+   {
+      cr_assert_geq(origpos[i], 0);
+      cr_assert_lt(origpos[i], len);
+      cr_assert_not(seen[origpos[i]], "position %d appears twice in the partner array\n", origpos[i]);
+      seen[origpos[i]] = TRUE;
+
+      cr_assert_eq(keys[i], origkeys[origpos[i]], "key %d at position %d was moved without its partner\n", keys[i], i);
+
+      if( i > 0 && keys[i - 1] == keys[i] )
+         cr_assert_lt(origpos[i - 1], origpos[i], "order of equal keys %d changed\n", keys[i]);
+   }
+
+   SCIPfreeBufferArray(scip, &seen);
+}
+
 /* TEST SUITE */
 static
 void setup(void)
@@ -177,3 +243,75 @@ Test(sort, desc_sort_down, .description = "tests SCIPsortDown by checking that t
 
    SCIPfreeBufferArray(scip, &perm);
 }
+
+Test(sort, radix_sort_up, .description = "tests SCIPsortIntInt on an array that is sorted by radix sort")
+{
+   int* keys;
+   int* origkeys;
+   int* origpos;
+   int len;
+   int i;
+
+   /* the array must be longer than the minimal size for radix sort in the sort template */
+   len = 20000;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, len) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &origkeys, len) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &origpos, len) );
+
+   fillRadixKeys(keys, origpos, len);
+   BMScopyMemoryArray(origkeys, keys, len);
+
+   SCIPsortIntInt(keys, origpos, len);
+
+   for( i = 0; i < len - 1; ++i )
+   {
+      cr_assert_leq(keys[i], keys[i+1], "keys %d and %d at position %d are not sorted ascending\n", keys[i], keys[i+1], i);
+   }
+   cr_assert_eq(keys[0], INT_MIN);
+   cr_assert_eq(keys[1], INT_MIN);
+   cr_assert_eq(keys[len - 1], INT_MAX);
+   cr_assert_eq(keys[len - 2], INT_MAX);
+
+   checkRadixPartners(keys, origpos, origkeys, len);
+
+   SCIPfreeBufferArray(scip, &origpos);
+   SCIPfreeBufferArray(scip, &origkeys);
+   SCIPfreeBufferArray(scip, &keys);
+}
+
+Test(sort, radix_sort_down, .description = "tests SCIPsortDownIntInt on an array that is sorted by radix sort")
+{
+   int* keys;
+   int* origkeys;
+   int* origpos;
+   int len;
+   int i;
+
+   /* the array must be longer than the minimal size for radix sort in the sort template */
+   len = 20000;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, len) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &origkeys, len) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &origpos, len) );
+
+   fillRadixKeys(keys, origpos, len);
+   BMScopyMemoryArray(origkeys, keys, len);
+
+   SCIPsortDownIntInt(keys, origpos, len);
+
+   for( i = 0; i < len - 1; ++i )
+   {
+      cr_assert_geq(keys[i], keys[i+1], "keys %d and %d at position %d are not sorted descending\n", keys[i], keys[i+1], i);
+   }
+   cr_assert_eq(keys[0], INT_MAX);
+   cr_assert_eq(keys[1], INT_MAX);
+   cr_assert_eq(keys[len - 1], INT_MIN);
+   cr_assert_eq(keys[len - 2], INT_MIN);
+
+   checkRadixPartners(keys, origpos, origkeys, len);
+
+   SCIPfreeBufferArray(scip, &origpos);
+   SCIPfreeBufferArray(scip, &origkeys);
+   SCIPfreeBufferArray(scip, &keys);
+}
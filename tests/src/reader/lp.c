@@ -0,0 +1,142 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   lp.c
+ * @brief  Unittest for the writer of the LP format with variable names of maximal length
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+#define NVARS       4
+#define NAMELEN     255        /* maximal length of a name in the LP format */
+#define MAXLINELEN  560        /* maximal length of a line written by the LP writer */
+
+static SCIP* scip;
+static const char* filename = "longnames.lp";
+static char varnames[NVARS][NAMELEN + 1];
+
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   SCIP_Real coefs[NVARS] = { 1.0, -2.0, 3.0, -4.0 };
+   SCIP_VAR* shortvars[2];
+   SCIP_VAR* quadvars1[3];
+   SCIP_VAR* quadvars2[3];
+   SCIP_Real quadcoefs[3] = { 0.123456789012345, -1.234567890123456, 9.87654321098765 };
+   SCIP_CONS* cons;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "longnames") );
+
+   SCIPsetMessagehdlrQuiet(scip, TRUE);
+
+   /* variable names of maximal length that only differ in their last character */
+   for( i = 0; i < NVARS; ++i )
+   {
+      memset(varnames[i], 'x', NAMELEN);
+      varnames[i][NAMELEN - 1] = (char)('a' + i);
+      varnames[i][NAMELEN] = '\0';
+
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], varnames[i], -10.0, 10.0, coefs[i], SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &shortvars[0], "shortvar1", -1.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, shortvars[0]) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &shortvars[1], "shortvar2", -1.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, shortvars[1]) );
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "lin", NVARS, vars, coefs, -5.0, 5.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   /* after a short bilinear term, the line is continued with bilinear terms that contain two names of maximal length
+    * each, which do not fit into the rest of the line
+    */
+   quadvars1[0] = shortvars[0];
+   quadvars2[0] = shortvars[1];
+   quadvars1[1] = vars[0];
+   quadvars2[1] = vars[1];
+   quadvars1[2] = vars[2];
+   quadvars2[2] = vars[3];
+   SCIP_CALL( SCIPcreateConsBasicQuadraticNonlinear(scip, &cons, "quad", NVARS, vars, coefs, 3, quadvars1, quadvars2,
+         quadcoefs, -SCIPinfinity(scip), 7.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPreleaseVar(scip, &shortvars[1]) );
+   SCIP_CALL( SCIPreleaseVar(scip, &shortvars[0]) );
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
+
+static
+void teardown(void)
+{
+   (void)remove(filename);
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* TEST SUITE */
+TestSuite(readerlp, .init = setup, .fini = teardown);
+
+Test(readerlp, longnames, .description = "check that bilinear terms with names of maximal length are written correctly")
+{
+   char line[4 * MAXLINELEN];
+   FILE* fp;
+   int i;
+
+   SCIP_CALL( SCIPwriteOrigProblem(scip, filename, NULL, FALSE) );
+
+   /* no line may exceed the line buffer of the writer */
+   fp = fopen(filename, "r");
+   cr_assert_not_null(fp);
+   while( fgets(line, (int)sizeof(line), fp) != NULL )
+   {
+      cr_assert_leq(strlen(line), MAXLINELEN + 1, "line too long: %s\n", line);
+   }
+   fclose(fp);
+
+   /* reading the file back gives the same variables and constraints; the ranged row is written as two rows */
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+
+   cr_assert_eq(SCIPgetNOrigVars(scip), NVARS + 2);
+   cr_assert_eq(SCIPgetNOrigConss(scip), 3);
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      cr_expect_not_null(SCIPfindVar(scip, varnames[i]), "variable <%s> is missing\n", varnames[i]);
+   }
+
+   cr_assert_not_null(SCIPfindCons(scip, "lin_lhs"));
+   cr_assert_not_null(SCIPfindCons(scip, "lin_rhs"));
+   cr_assert_not_null(SCIPfindCons(scip, "quad"));
+   cr_expect_eq(SCIPgetNVarsLinear(scip, SCIPfindCons(scip, "lin_lhs")), NVARS);
+   cr_expect_str_eq(SCIPconshdlrGetName(SCIPconsGetHdlr(SCIPfindCons(scip, "quad"))), "nonlinear");
+}
@@ -0,0 +1,248 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   sbp.c
+ * @brief  Unittest for reader and writer of SCIP's binary problem format
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scipdefplugins.h"
+#include "scip/reader_sbp.h"
+
+#include "include/scip_test.h"
+
+#define NVARS  3
+#define NCONSS 3
+#define NNONZS 7
+
+/* size of the file header: magic string, six 32-bit integers, the length of the name table, and the offset */
+#define HEADERSIZE 48
+
+static SCIP* scip;
+static const char* filename = "roundtrip.sbp";
+static const char* corruptfilename = "corrupt.sbp";
+
+/* problem data */
+static const char* varnames[NVARS] = { "x", "y", "z" };
+static const SCIP_VARTYPE vartypes[NVARS] = { SCIP_VARTYPE_BINARY, SCIP_VARTYPE_INTEGER, SCIP_VARTYPE_CONTINUOUS };
+static const SCIP_Real varlbs[NVARS] = { 0.0, -5.0, -1.5 };
+static const SCIP_Real varubs[NVARS] = { 1.0, 7.0, 1e+20 };
+static const SCIP_Real varobjs[NVARS] = { 3.0, -2.0, 0.5 };
+static const char* consnames[NCONSS] = { "knap", "range", "cover" };
+static const int consbeg[NCONSS + 1] = { 0, 3, 5, 7 };
+static const int consind[NNONZS] = { 0, 1, 2, 1, 2, 0, 1 };
+static const SCIP_Real consvals[NNONZS] = { 1.0, 2.0, 3.0, 1.0, -1.0, 1.0, 1.0 };
+static const SCIP_Real conslhs[NCONSS] = { -1e+20, 1.0, 1.0 };
+static const SCIP_Real consrhs[NCONSS] = { 10.0, 5.0, 1e+20 };
+static const SCIP_Real objoffset = 4.25;
+
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   int i;
+
+   /* create SCIP instance */
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "sbptest") );
+
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+   SCIP_CALL( SCIPaddOrigObjoffset(scip, objoffset) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], varnames[i], varlbs[i], varubs[i], varobjs[i], vartypes[i]) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   for( i = 0; i < NCONSS; ++i )
+   {
+      SCIP_CONS* cons;
+      int j;
+
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, consnames[i], 0, NULL, NULL, conslhs[i], consrhs[i]) );
+      for( j = consbeg[i]; j < consbeg[i+1]; ++j )
+      {
+         SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[consind[j]], consvals[j]) );
+      }
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPwriteOrigProblem(scip, filename, NULL, FALSE) );
+}
+
+static
+void teardown(void)
+{
+   (void)remove(filename);
+   (void)remove(corruptfilename);
+
+   /* free SCIP */
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** reads the written file into memory and returns its length */
+static
+long readFile(
+   char*                 buffer,             /**< buffer to store the content of the file */
+   long                  buffersize          /**< size of the buffer */
+   )
+{
+   FILE* fp;
+   long len;
+
+   fp = fopen(filename, "rb");
+   cr_assert_not_null(fp);
+   len = (long)fread(buffer, 1, (size_t)buffersize, fp);
+   fclose(fp);
+
+   cr_assert_gt(len, HEADERSIZE);
+   cr_assert_lt(len, buffersize);
+
+   return len;
+}
+
+/** writes the given content to the file for corrupted input */
+static
+void writeCorruptFile(
+   const char*           buffer,             /**< content to write */
+   long                  len                 /**< number of bytes to write */
+   )
+{
+   FILE* fp;
+
+   fp = fopen(corruptfilename, "wb");
+   cr_assert_not_null(fp);
+   cr_assert_eq(fwrite(buffer, 1, (size_t)len, fp), (size_t)len);
+   fclose(fp);
+}
+
+/* TEST SUITE */
+TestSuite(readersbp, .init = setup, .fini = teardown);
+
+Test(readersbp, roundtrip, .description = "check that writing and reading a *.sbp file reproduces the problem")
+{
+   int i;
+
+   SCIP_CALL( SCIPreadProb(scip, filename, NULL) );
+
+   cr_expect_eq(SCIPgetObjsense(scip), SCIP_OBJSENSE_MAXIMIZE);
+   cr_expect(SCIPisEQ(scip, SCIPgetOrigObjoffset(scip), objoffset));
+   cr_assert_eq(SCIPgetNOrigVars(scip), NVARS);
+   cr_assert_eq(SCIPgetNOrigConss(scip), NCONSS);
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* var;
+
+      var = SCIPfindVar(scip, varnames[i]);
+      cr_assert_not_null(var, "variable <%s> is missing\n", varnames[i]);
+
+      cr_expect_eq(SCIPvarGetType(var), vartypes[i]);
+      cr_expect(SCIPisEQ(scip, SCIPvarGetLbOriginal(var), varlbs[i]));
+      cr_expect(SCIPisEQ(scip, SCIPvarGetUbOriginal(var), varubs[i]));
+      cr_expect(SCIPisEQ(scip, SCIPvarGetObj(var), varobjs[i]));
+   }
+
+   for( i = 0; i < NCONSS; ++i )
+   {
+      SCIP_CONS* cons;
+      SCIP_VAR** vars;
+      SCIP_Real* vals;
+      int j;
+
+      cons = SCIPfindCons(scip, consnames[i]);
+      cr_assert_not_null(cons, "constraint <%s> is missing\n", consnames[i]);
+      cr_assert_str_eq(SCIPconshdlrGetName(SCIPconsGetHdlr(cons)), "linear");
+
+      cr_expect(SCIPisEQ(scip, SCIPgetLhsLinear(scip, cons), conslhs[i]));
+      cr_expect(SCIPisEQ(scip, SCIPgetRhsLinear(scip, cons), consrhs[i]));
+      cr_assert_eq(SCIPgetNVarsLinear(scip, cons), consbeg[i+1] - consbeg[i]);
+
+      vars = SCIPgetVarsLinear(scip, cons);
+      vals = SCIPgetValsLinear(scip, cons);
+      for( j = consbeg[i]; j < consbeg[i+1]; ++j )
+      {
+         cr_expect_str_eq(SCIPvarGetName(vars[j - consbeg[i]]), varnames[consind[j]]);
+         cr_expect(SCIPisEQ(scip, vals[j - consbeg[i]], consvals[j]));
+      }
+   }
+}
+
+Test(readersbp, truncated, .description = "check that reading a truncated *.sbp file fails with a read error")
+{
+   char buffer[4096];
+   long len;
+   long cut;
+
+   len = readFile(buffer, (long)sizeof(buffer));
+
+   /* cut off the file within the header, the arrays, and the name table */
+   for( cut = 0; cut < len; ++cut )
+   {
+      writeCorruptFile(buffer, cut);
+      cr_assert_eq(SCIPreadProb(scip, corruptfilename, NULL), SCIP_READERROR, "file truncated to %ld bytes was read\n",
+         cut);
+   }
+}
+
+Test(readersbp, corrupted, .description = "check that reading a corrupted *.sbp file fails with a read error")
+{
+   char buffer[4096];
+   int32_t value;
+   long len;
+   long pos;
+
+   len = readFile(buffer, (long)sizeof(buffer));
+
+   /* wrong magic string */
+   buffer[0] = 'X';
+   writeCorruptFile(buffer, len);
+   cr_expect_eq(SCIPreadProb(scip, corruptfilename, NULL), SCIP_READERROR);
+   buffer[0] = 'S';
+
+   /* negative number of variables, which is the fourth integer of the header after the magic string */
+   pos = 8 + 3 * (long)sizeof(int32_t);
+   memcpy(&value, &buffer[pos], sizeof(value));
+   cr_assert_eq(value, NVARS);
+   value = -1;
+   memcpy(&buffer[pos], &value, sizeof(value));
+   writeCorruptFile(buffer, len);
+   cr_expect_eq(SCIPreadProb(scip, corruptfilename, NULL), SCIP_READERROR);
+   value = NVARS;
+   memcpy(&buffer[pos], &value, sizeof(value));
+
+   /* column index out of range; the column indices follow the variable data, the sides, and the row starts */
+   pos = HEADERSIZE + NVARS * (3 * (long)sizeof(double) + 1) + NCONSS * 2 * (long)sizeof(double)
+      + (NCONSS + 1) * (long)sizeof(int32_t);
+   memcpy(&value, &buffer[pos], sizeof(value));
+   cr_assert_eq(value, consind[0]);
+   value = NVARS;
+   memcpy(&buffer[pos], &value, sizeof(value));
+   writeCorruptFile(buffer, len);
+   cr_expect_eq(SCIPreadProb(scip, corruptfilename, NULL), SCIP_READERROR);
+}
@@ -0,0 +1,371 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   statisticsjson.c
+ * @brief  unit test checking that SCIPprintStatisticsJson() outputs valid JSON
+ *
+ * A small problem is solved and the JSON statistics are parsed by a minimal JSON parser, which also checks that the
+ * expected keys are present. A heuristic with quotes and backslashes in its name checks the escaping of strings.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <ctype.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "include/scip_test.h"
+
+/** name of the test heuristic, which needs to be escaped in JSON */
+#define HEURNAME "json\"heur\\name"
+
+/** escaped name of the test heuristic */
+#define HEURNAMEESCAPED "\"json\\\"heur\\\\name\""
+
+/* GLOBAL VARIABLES */
+static SCIP* scip = NULL;
+
+/** keys that must appear in the top-level object */
+static const char* topkeys[] = { "status", "solvingtime", "presolvingtime", "nruns", "nnodes", "nlpiterations",
+   "nsols", "primalbound", "dualbound", "gap", "presolvers", "constrainthandlers", "propagators", "separators",
+   "heuristics" };
+#define NTOPKEYS ((int)(sizeof(topkeys) / sizeof(topkeys[0])))
+
+/** number of times each top-level key was found */
+static int ntopkeysfound[NTOPKEYS];
+
+/*
+ * minimal JSON parser; each method returns the position after the parsed element, or NULL if the input is invalid
+ */
+
+static const char* parseValue(const char* pos, int depth);
+
+/** skips white space */
+static
+const char* skipSpace(
+   const char*           pos                 /**< current position */
+   )
+{
+   while( *pos == ' ' || *pos == '\n' || *pos == '\r' || *pos == '\t' )
+      ++pos;
+
+   return pos;
+}
+
+/** parses a string and stores its unescaped content, truncated to the buffer size */
+static
+const char* parseString(
+   const char*           pos,                /**< current position */
+   char*                 buffer,             /**< buffer to store the content, or NULL */
+   int                   buffersize          /**< size of the buffer */
+   )
+{
+   int len = 0;
+
+   if( *pos != '"' )
+      return NULL;
+   ++pos;
+
+   while( *pos != '"' )
+   {
+      char c;
+
+      /* control characters need to be escaped */
+      if( (unsigned char)*pos < 0x20 )
+         return NULL;
+
+      if( *pos == '\\' )
+      {
+         ++pos;
+         switch( *pos )
+         {
+         case '"': case '\\': case '/':
+            c = *pos;
+            break;
+         case 'b': case 'f': case 'n': case 'r': case 't':
+            c = ' ';
+            break;
+         case 'u':
+         {
+            int k;
+
+            for( k = 1; k <= 4; ++k )
+            {
+               if( !isxdigit((unsigned char)pos[k]) )
+                  return NULL;
+            }
+            pos += 4;
+            c = '?';
+            break;
+         }
+         default:
+            return NULL;
+         }
+      }
+      else
+         c = *pos;
+
+      if( buffer != NULL && len < buffersize - 1 )
+         buffer[len++] = c;
+      ++pos;
+   }
+
+   if( buffer != NULL )
+      buffer[len] = '\0';
+
+   return pos + 1;
+}
+
+/** parses a number */
+static
+const char* parseNumber(
+   const char*           pos                 /**< current position */
+   )
+{
+   const char* start;
+
+   if( *pos == '-' )
+      ++pos;
+
+   start = pos;
+   while( isdigit((unsigned char)*pos) )
+      ++pos;
+   if( pos == start || (*start == '0' && pos - start > 1) )
+      return NULL;
+
+   if( *pos == '.' )
+   {
+      start = ++pos;
+      while( isdigit((unsigned char)*pos) )
+         ++pos;
+      if( pos == start )
+         return NULL;
+   }
+
+   if( *pos == 'e' || *pos == 'E' )
+   {
+      ++pos;
+      if( *pos == '+' || *pos == '-' )
+         ++pos;
+      start = pos;
+      while( isdigit((unsigned char)*pos) )
+         ++pos;
+      if( pos == start )
+         return NULL;
+   }
+
+   return pos;
+}
+
+/** parses an object; at depth 0, the keys are counted in ntopkeysfound */
+static
+const char* parseObject(
+   const char*           pos,                /**< current position */
+   int                   depth               /**< depth of the object */
+   )
+{
+   assert(*pos == '{');
+
+   pos = skipSpace(pos + 1);
+   if( *pos == '}' )
+      return pos + 1;
+
+   while( TRUE ) /*lint !e716*/
+   {
+      char key[SCIP_MAXSTRLEN];
+      int k;
+
+      pos = parseString(skipSpace(pos), key, SCIP_MAXSTRLEN);
+      if( pos == NULL )
+         return NULL;
+
+      if( depth == 0 )
+      {
+         for( k = 0; k < NTOPKEYS; ++k )
+         {
+            if( strcmp(key, topkeys[k]) == 0 )
+               ++ntopkeysfound[k];
+         }
+      }
+
+      pos = skipSpace(pos);
+      if( *pos != ':' )
+         return NULL;
+
+      pos = parseValue(pos + 1, depth + 1);
+      if( pos == NULL )
+         return NULL;
+
+      pos = skipSpace(pos);
+      if( *pos == '}' )
+         return pos + 1;
+      if( *pos != ',' )
+         return NULL;
+      ++pos;
+   }
+}
+
+/** parses an array */
+static
+const char* parseArray(
+   const char*           pos,                /**< current position */
+   int                   depth               /**< depth of the array */
+   )
+{
+   assert(*pos == '[');
+
+   pos = skipSpace(pos + 1);
+   if( *pos == ']' )
+      return pos + 1;
+
+   while( TRUE ) /*lint !e716*/
+   {
+      pos = parseValue(pos, depth + 1);
+      if( pos == NULL )
+         return NULL;
+
+      pos = skipSpace(pos);
+      if( *pos == ']' )
+         return pos + 1;
+      if( *pos != ',' )
+         return NULL;
+      ++pos;
+   }
+}
+
+/** parses any JSON value */
+static
+const char* parseValue(
+   const char*           pos,                /**< current position */
+   int                   depth               /**< depth of the value */
+   )
+{
+   pos = skipSpace(pos);
+
+   switch( *pos )
+   {
+   case '{':
+      return parseObject(pos, depth);
+   case '[':
+      return parseArray(pos, depth);
+   case '"':
+      return parseString(pos, NULL, 0);
+   case 't':
+      return strncmp(pos, "true", 4) == 0 ? pos + 4 : NULL;
+   case 'f':
+      return strncmp(pos, "false", 5) == 0 ? pos + 5 : NULL;
+   case 'n':
+      return strncmp(pos, "null", 4) == 0 ? pos + 4 : NULL;
+   default:
+      return parseNumber(pos);
+   }
+}
+
+/** execution method of the test heuristic, which does nothing */
+static
+SCIP_DECL_HEUREXEC(heurExecJson)
+{  /*lint --e{715}*/
+   *result = SCIP_DIDNOTRUN;
+
+   return SCIP_OKAY;
+}
+
+/* TEST SUITE */
+static
+void setup(void)
+{
+   SCIP_HEUR* heur;
+   SCIP_VAR* x;
+   SCIP_VAR* y;
+   SCIP_CONS* cons;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur, HEURNAME, "heuristic with a name that needs escaping", 'x', 0, 1, 0, -1,
+         SCIP_HEURTIMING_AFTERNODE, FALSE, heurExecJson, NULL) );
+
+   SCIPsetMessagehdlrQuiet(scip, TRUE);
+
+   /* min x + 2y s.t. x + y >= 1 over binaries, which is solved in presolving */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "json") );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &x, "x", 0.0, 1.0, 1.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", 0.0, 1.0, 2.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPaddVar(scip, x) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "cover", 0, NULL, NULL, 1.0, SCIPinfinity(scip)) );
+   SCIP_CALL( SCIPaddCoefLinear(scip, cons, x, 1.0) );
+   SCIP_CALL( SCIPaddCoefLinear(scip, cons, y, 1.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+   SCIP_CALL( SCIPreleaseVar(scip, &x) );
+}
+
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(statisticsjson, .init = setup, .fini = teardown);
+
+/* TESTS */
+
+/** the JSON statistics of a solved problem are valid JSON and contain the expected keys */
+Test(statisticsjson, validjson)
+{
+   FILE* file;
+   char* output;
+   const char* end;
+   long len;
+   int k;
+
+   SCIP_CALL( SCIPsolve(scip) );
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+
+   file = tmpfile();
+   cr_assert_not_null(file);
+
+   SCIP_CALL( SCIPprintStatisticsJson(scip, file) );
+
+   len = ftell(file);
+   cr_assert_gt(len, 0);
+   rewind(file);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &output, len + 1) );
+   cr_assert_eq(fread(output, 1, (size_t)len, file), (size_t)len);
+   output[len] = '\0';
+   fclose(file);
+
+   /* the output consists of exactly one object */
+   BMSclearMemoryArray(ntopkeysfound, NTOPKEYS);
+   end = skipSpace(output);
+   cr_assert_eq(*end, '{', "output does not start with an object");
+   end = parseValue(end, 0);
+   cr_assert_not_null(end, "output is not valid JSON:\n%s", output);
+   cr_assert_eq(*skipSpace(end), '\0', "output continues after the JSON object:\n%s", output);
+
+   for( k = 0; k < NTOPKEYS; ++k )
+   {
+      cr_expect_eq(ntopkeysfound[k], 1, "key <%s> found %d times\n", topkeys[k], ntopkeysfound[k]);
+   }
+
+   cr_expect_not_null(strstr(output, "\"status\": \"optimal solution found\""));
+   cr_expect_not_null(strstr(output, HEURNAMEESCAPED), "heuristic name is not escaped:\n%s", output);
+
+   SCIPfreeBufferArray(scip, &output);
+}